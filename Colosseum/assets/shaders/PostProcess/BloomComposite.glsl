@@ -0,0 +1,33 @@
+// Adds the blurred bright parts back onto the full resolution scene
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+out vec2 v_TexCoord;
+
+void main()
+{
+	v_TexCoord = a_TexCoord;
+	gl_Position = vec4(a_Position, 0.0, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Texture;
+uniform sampler2D u_Scene;
+uniform float u_Intensity;
+
+void main()
+{
+	vec3 bloom = texture(u_Texture, v_TexCoord).rgb;
+	vec3 scene = texture(u_Scene, v_TexCoord).rgb;
+	color = vec4(scene + bloom * u_Intensity, 1.0);
+}
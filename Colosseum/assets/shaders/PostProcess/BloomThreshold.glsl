@@ -0,0 +1,33 @@
+// Keeps what is brighter than u_Threshold, runs at reduced resolution as the start of the bloom chain
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+out vec2 v_TexCoord;
+
+void main()
+{
+	v_TexCoord = a_TexCoord;
+	gl_Position = vec4(a_Position, 0.0, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Texture;
+uniform float u_Threshold;
+
+void main()
+{
+	vec3 scene = texture(u_Texture, v_TexCoord).rgb;
+	float brightness = max(scene.r, max(scene.g, scene.b));
+	float contribution = max(brightness - u_Threshold, 0.0) / max(brightness, 0.0001);
+	color = vec4(scene * contribution, 1.0);
+}
@@ -0,0 +1,42 @@
+// Separable 9 tap gaussian in 5 linearly filtered samples, u_Direction is (1, 0) or (0, 1)
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+out vec2 v_TexCoord;
+
+void main()
+{
+	v_TexCoord = a_TexCoord;
+	gl_Position = vec4(a_Position, 0.0, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Texture;
+uniform vec2 u_TexelSize;
+uniform vec2 u_Direction;
+
+const float c_Offsets[3] = float[](0.0, 1.3846153846, 3.2307692308);
+const float c_Weights[3] = float[](0.2270270270, 0.3162162162, 0.0702702703);
+
+void main()
+{
+	vec2 offset = u_Direction * u_TexelSize;
+
+	vec3 result = texture(u_Texture, v_TexCoord).rgb * c_Weights[0];
+	for (int i = 1; i < 3; i++)
+	{
+		result += texture(u_Texture, v_TexCoord + offset * c_Offsets[i]).rgb * c_Weights[i];
+		result += texture(u_Texture, v_TexCoord - offset * c_Offsets[i]).rgb * c_Weights[i];
+	}
+	color = vec4(result, 1.0);
+}
@@ -0,0 +1,52 @@
+// Looks colors up in a strip LUT: N slices of N x N, red across a slice, green down, blue picks the slice.
+// The LUT is read with texelFetch and filtered here, textures magnify with nearest filtering.
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+out vec2 v_TexCoord;
+
+void main()
+{
+	v_TexCoord = a_TexCoord;
+	gl_Position = vec4(a_Position, 0.0, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Texture;
+uniform sampler2D u_LUT;
+uniform float u_Strength;
+
+vec3 FetchSlice(ivec2 base, vec2 rg, int size)
+{
+	ivec2 lo = ivec2(floor(rg));
+	ivec2 hi = min(lo + 1, ivec2(size - 1));
+	vec2 f = rg - vec2(lo);
+
+	vec3 a = mix(texelFetch(u_LUT, base + ivec2(lo.x, lo.y), 0).rgb, texelFetch(u_LUT, base + ivec2(hi.x, lo.y), 0).rgb, f.x);
+	vec3 b = mix(texelFetch(u_LUT, base + ivec2(lo.x, hi.y), 0).rgb, texelFetch(u_LUT, base + ivec2(hi.x, hi.y), 0).rgb, f.x);
+	return mix(a, b, f.y);
+}
+
+void main()
+{
+	vec3 scene = clamp(texture(u_Texture, v_TexCoord).rgb, 0.0, 1.0);
+	int size = textureSize(u_LUT, 0).y;
+	vec3 scaled = scene * float(size - 1);
+
+	int slice = int(floor(scaled.b));
+	int nextSlice = min(slice + 1, size - 1);
+	vec3 graded = mix(FetchSlice(ivec2(slice * size, 0), scaled.rg, size),
+		FetchSlice(ivec2(nextSlice * size, 0), scaled.rg, size), scaled.b - float(slice));
+
+	color = vec4(mix(scene, graded, u_Strength), 1.0);
+}
@@ -0,0 +1,60 @@
+// FXAA, the edge direction comes from the luma of the four diagonal neighbours
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec2 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+out vec2 v_TexCoord;
+
+void main()
+{
+	v_TexCoord = a_TexCoord;
+	gl_Position = vec4(a_Position, 0.0, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Texture;
+uniform vec2 u_TexelSize;
+
+const float c_ReduceMin = 1.0 / 128.0;
+const float c_ReduceMul = 1.0 / 8.0;
+const float c_SpanMax = 8.0;
+
+float Luma(vec3 rgb)
+{
+	return dot(rgb, vec3(0.299, 0.587, 0.114));
+}
+
+void main()
+{
+	vec3 rgbM = texture(u_Texture, v_TexCoord).rgb;
+	float lumaNW = Luma(texture(u_Texture, v_TexCoord + vec2(-1.0, -1.0) * u_TexelSize).rgb);
+	float lumaNE = Luma(texture(u_Texture, v_TexCoord + vec2( 1.0, -1.0) * u_TexelSize).rgb);
+	float lumaSW = Luma(texture(u_Texture, v_TexCoord + vec2(-1.0,  1.0) * u_TexelSize).rgb);
+	float lumaSE = Luma(texture(u_Texture, v_TexCoord + vec2( 1.0,  1.0) * u_TexelSize).rgb);
+	float lumaM = Luma(rgbM);
+
+	float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));
+	float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));
+
+	vec2 direction = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)), (lumaNW + lumaSW) - (lumaNE + lumaSE));
+	float reduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * 0.25 * c_ReduceMul, c_ReduceMin);
+	float scale = 1.0 / (min(abs(direction.x), abs(direction.y)) + reduce);
+	direction = clamp(direction * scale, vec2(-c_SpanMax), vec2(c_SpanMax)) * u_TexelSize;
+
+	vec3 rgbA = 0.5 * (texture(u_Texture, v_TexCoord + direction * (1.0 / 3.0 - 0.5)).rgb +
+		texture(u_Texture, v_TexCoord + direction * (2.0 / 3.0 - 0.5)).rgb);
+	vec3 rgbB = rgbA * 0.5 + 0.25 * (texture(u_Texture, v_TexCoord - direction * 0.5).rgb +
+		texture(u_Texture, v_TexCoord + direction * 0.5).rgb);
+
+	float lumaB = Luma(rgbB);
+	color = vec4(lumaB < lumaMin || lumaB > lumaMax ? rgbA : rgbB, 1.0);
+}
@@ -0,0 +1,58 @@
+// Virtual Texture Shader
+// u_Texture is the page cache atlas, u_PageTable the page table bound right after it.
+// u_VirtualTexture comes from VirtualTexture2D::GetShaderParameters().
+
+#type vertex
+#version 330 core
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_TexCoord;
+
+uniform mat4 u_ViewProjection;
+uniform mat4 u_Transform;
+
+out vec2 v_TexCoord;
+
+void main()
+{
+	v_TexCoord = a_TexCoord;
+	gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+}
+
+#type fragment
+#version 330 core
+
+layout(location = 0) out vec4 color;
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Texture;
+uniform sampler2D u_PageTable;
+uniform vec4 u_VirtualTexture; // xy: UV scale, z: page size, w: border
+
+vec4 SampleVirtual(vec2 uv)
+{
+	vec2 pages = vec2(textureSize(u_PageTable, 0));
+	float pageSize = u_VirtualTexture.z;
+	float border = u_VirtualTexture.w;
+
+	// Same level the CPU feedback asks for
+	vec2 virtualUV = clamp(uv * u_VirtualTexture.xy, vec2(0.0), vec2(0.99999));
+	vec2 texel = virtualUV * pages * pageSize;
+	vec2 dx = dFdx(texel);
+	vec2 dy = dFdy(texel);
+	float level = clamp(floor(0.5 * log2(max(max(dot(dx, dx), dot(dy, dy)), 1.0))), 0.0, log2(pages.x));
+
+	// The entry's level can be coarser than the one asked for while pages stream in
+	ivec2 tableSize = textureSize(u_PageTable, int(level));
+	vec3 entry = floor(texelFetch(u_PageTable, ivec2(virtualUV * vec2(tableSize)), int(level)).xyz * 255.0 + 0.5);
+	vec2 inPage = fract(virtualUV * pages / exp2(entry.z));
+
+	vec2 atlasTexel = entry.xy * (pageSize + 2.0 * border) + border + inPage * pageSize;
+	return textureLod(u_Texture, atlasTexel / vec2(textureSize(u_Texture, 0)), 0.0);
+}
+
+void main()
+{
+	color = SampleVirtual(v_TexCoord);
+}
@@ -1,7 +1,7 @@
 #include "rmpch.h"
 #include <RoMan.h>
 
-#include "Platform/OpenGL/OpenGLShader.h"
+#include "RoMan/Events/MouseEvent.h"
 
 #include "imgui/imgui.h"
 #include "glm/glm.hpp"
@@ -13,7 +13,7 @@ class ExampleLayer : public RoMan::Layer
 {
 public:
 	ExampleLayer()
-		: Layer("Example"), m_Camera(-1.6f, 1.6f, -0.9f, 0.9f), m_CameraPosition(0.0f)
+		: Layer("Example"), m_CameraController(1280.0f / 720.0f, true)
 	{
 		m_VertexArray.reset(RoMan::VertexArray::Create());
 
@@ -39,6 +39,7 @@ public:
 		RoMan::Ref<RoMan::IndexBuffer> indexBuffer;
 		indexBuffer.reset(RoMan::IndexBuffer::Create(indices, sizeof(indices) / sizeof(uint32_t)));
 		m_VertexArray->SetIndexBuffer(indexBuffer);
+		m_VertexArray->SetBounds({ { -0.5f, -0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f } });
 
 		m_SquareVA.reset(RoMan::VertexArray::Create());
 		float squareVertices[5 * 4] = {
@@ -60,6 +61,7 @@ public:
 		RoMan::Ref<RoMan::IndexBuffer> squareIB;
 		squareIB.reset(RoMan::IndexBuffer::Create(squareIndices, sizeof(squareIndices) / sizeof(uint32_t)));
 		m_SquareVA->SetIndexBuffer(squareIB);
+		m_SquareVA->SetBounds({ { -0.5f, -0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f } });
 
 		std::string vertexSrc = R"(
 			#version 330 core
@@ -134,54 +136,124 @@ public:
 
 		auto textureShader = m_ShaderLibrary.Load("assets/shaders/Texture.glsl");
 
-		m_Texture = RoMan::Texture2D::Create("assets/textures/Checkerboard.png");
-		m_RITlogoTexture = RoMan::Texture2D::Create("assets/textures/RITlogo.png");
+		m_Texture = RoMan::AssetManager::Load<RoMan::Texture2D>("assets/textures/Checkerboard.png");
+		m_RITlogoTexture = RoMan::AssetManager::Load<RoMan::Texture2D>("assets/textures/RITlogo.png");
+
+		textureShader->Bind();
+		textureShader->SetInt("u_Texture", 0);
+
+		// The scene renders offscreen and is stretched onto the window, so it can run below native resolution
+		auto& window = RoMan::Application::Get().GetWindow();
+		RoMan::FramebufferSpecification framebufferSpec;
+		framebufferSpec.Width = window.GetWidth();
+		framebufferSpec.Height = window.GetHeight();
+		framebufferSpec.Attachments = { RoMan::FramebufferTextureFormat::RGBA8, RoMan::FramebufferTextureFormat::Depth };
+		framebufferSpec.RenderScale = m_RenderScale;
+		m_Framebuffer = RoMan::Framebuffer::Create(framebufferSpec);
+
+		// Bloom works on reduced copies of the scene, grading and FXAA on the full resolution result
+		m_ColorGradingLUT = RoMan::AssetManager::Load<RoMan::Texture2D>("assets/textures/ColorGradingLUT.png");
+		auto blurShader = m_ShaderLibrary.Load("assets/shaders/PostProcess/Blur.glsl");
+
+		RoMan::PostProcessPass bloomThreshold;
+		bloomThreshold.Name = "Bloom Threshold";
+		bloomThreshold.PassShader = m_ShaderLibrary.Load("assets/shaders/PostProcess/BloomThreshold.glsl");
+		bloomThreshold.Resolution = RoMan::PostProcessResolution::Half;
+		bloomThreshold.SetUniforms = [this](RoMan::Shader& shader) { shader.SetFloat("u_Threshold", m_BloomThreshold); };
+		m_PostProcess.AddPass(bloomThreshold);
+
+		RoMan::PostProcessPass blurHorizontal;
+		blurHorizontal.Name = "Bloom Blur H";
+		blurHorizontal.PassShader = blurShader;
+		blurHorizontal.Resolution = RoMan::PostProcessResolution::Quarter;
+		blurHorizontal.SetUniforms = [](RoMan::Shader& shader) { shader.SetFloat2("u_Direction", { 1.0f, 0.0f }); };
+		m_PostProcess.AddPass(blurHorizontal);
+
+		RoMan::PostProcessPass blurVertical = blurHorizontal;
+		blurVertical.Name = "Bloom Blur V";
+		blurVertical.SetUniforms = [](RoMan::Shader& shader) { shader.SetFloat2("u_Direction", { 0.0f, 1.0f }); };
+		m_PostProcess.AddPass(blurVertical);
+
+		RoMan::PostProcessPass bloomComposite;
+		bloomComposite.Name = "Bloom Composite";
+		bloomComposite.PassShader = m_ShaderLibrary.Load("assets/shaders/PostProcess/BloomComposite.glsl");
+		bloomComposite.ReadsScene = true;
+		bloomComposite.SetUniforms = [this](RoMan::Shader& shader) { shader.SetFloat("u_Intensity", m_BloomIntensity); };
+		m_PostProcess.AddPass(bloomComposite);
+
+		RoMan::PostProcessPass colorGrading;
+		colorGrading.Name = "Color Grading";
+		colorGrading.PassShader = m_ShaderLibrary.Load("assets/shaders/PostProcess/ColorGrading.glsl");
+		colorGrading.SetUniforms = [this](RoMan::Shader& shader)
+		{
+			m_ColorGradingLUT->Bind(2);
+			shader.SetInt("u_LUT", 2);
+			shader.SetFloat("u_Strength", m_GradingStrength);
+		};
+		m_PostProcess.AddPass(colorGrading);
 
-		std::dynamic_pointer_cast<RoMan::OpenGLShader>(textureShader)->Bind();
-		std::dynamic_pointer_cast<RoMan::OpenGLShader>(textureShader)->UploadUniformInt("u_Texture", 0);
-	}
+		RoMan::PostProcessPass fxaa;
+		fxaa.Name = "FXAA";
+		fxaa.PassShader = m_ShaderLibrary.Load("assets/shaders/PostProcess/FXAA.glsl");
+		m_PostProcess.AddPass(fxaa);
 
-	void OnUpdate(RoMan::Timestep ts) override
-	{
-		if (RoMan::Input::IsKeyPressed(RM_KEY_LEFT))
-			m_CameraPosition.x -= m_CameraMoveSpeed * ts;
-		else if (RoMan::Input::IsKeyPressed(RM_KEY_RIGHT))
-			m_CameraPosition.x += m_CameraMoveSpeed * ts;
+		// Grid of quads parented to one node, so moving the grid only dirties its subtree
+		auto& hierarchy = m_Scene.GetTransformHierarchy();
+		m_Grid = m_Scene.CreateEntity("Grid").GetID();
+		hierarchy.Attach(m_Grid);
 
-		if (RoMan::Input::IsKeyPressed(RM_KEY_UP))
-			m_CameraPosition.y += m_CameraMoveSpeed * ts;
-		else if (RoMan::Input::IsKeyPressed(RM_KEY_DOWN))
-			m_CameraPosition.y -= m_CameraMoveSpeed * ts;
+		for (int x = 0; x < 20; x++)
+		{
+			for (int y = 0; y < 20; y++)
+			{
+				RoMan::EntityID quad = m_Scene.CreateEntity("Quad").GetID();
+				hierarchy.Attach(quad, m_Grid);
+				hierarchy.SetLocalTranslation(quad, { x * 0.11f, y * 0.11f, 0.0f });
+				hierarchy.SetLocalScale(quad, glm::vec3(0.1f));
+				m_Quads.push_back(quad);
+			}
+		}
 
-		if (RoMan::Input::IsKeyPressed(RM_KEY_Z))
-			m_CameraRotation += m_CameraRotationspeed * ts;
-		else if (RoMan::Input::IsKeyPressed(RM_KEY_X))
-			m_CameraRotation -= m_CameraRotationspeed * ts;
+		hierarchy.Update();
+		for (uint32_t i = 0; i < (uint32_t)m_Quads.size(); i++)
+		{
+			RoMan::AABB bounds = m_SquareVA->GetBounds().Transform(hierarchy.GetWorldTransform(m_Quads[i]));
+			m_QuadItems.push_back(m_QuadIndex.Insert(bounds, i));
+		}
+	}
 
+	void OnUpdate(RoMan::Timestep ts) override
+	{
+		m_CameraController.OnUpdate(ts);
 
+		m_Framebuffer->Bind();
 		RoMan::RenderCommand::SetClearColor({ 0.1, 0.1, 0.1, 1 });
 		RoMan::RenderCommand::Clear();
 
-		m_Camera.SetPosition(m_CameraPosition);
-		m_Camera.SetRotation(m_CameraRotation);
-
-		RoMan::Renderer::BeginScene(m_Camera);
-
-		glm::mat4 scale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
+		RoMan::Renderer::BeginScene(m_CameraController.GetCamera());
 
-		std::dynamic_pointer_cast<RoMan::OpenGLShader>(m_FlatColorShader)->Bind();
-		std::dynamic_pointer_cast<RoMan::OpenGLShader>(m_FlatColorShader)->UploadUniformFloat3("u_Color", m_SquareColor);
+		auto& hierarchy = m_Scene.GetTransformHierarchy();
+		hierarchy.Update();
 
-		for (int x = 0; x < 20; x++)
+		for (uint32_t i = 0; i < (uint32_t)m_Quads.size(); i++)
 		{
-			for (int y = 0; y < 20; y++)
-			{
-				glm::vec3 pos(x * 0.11f, y * 0.11f, 0.0f);
-				glm::mat4 transform = glm::translate(glm::mat4(1.0f), pos) * scale;
-				RoMan::Renderer::Submit(m_FlatColorShader, m_SquareVA, transform);
-			}
+			if (!hierarchy.HasChanged(m_Quads[i]))
+				continue;
+
+			RoMan::AABB bounds = m_SquareVA->GetBounds().Transform(hierarchy.GetWorldTransform(m_Quads[i]));
+			m_QuadIndex.Update(m_QuadItems[i], bounds);
 		}
 
+		m_FlatColorShader->Bind();
+		m_FlatColorShader->SetFloat3("u_Color", m_SquareColor);
+
+		// Only quads the grid reports inside the camera are submitted
+		m_VisibleQuads.clear();
+		m_QuadIndex.Query(m_CameraController.GetCamera().GetBounds(), m_VisibleQuads);
+
+		for (uint32_t i : m_VisibleQuads)
+			RoMan::Renderer::Submit(m_FlatColorShader, m_SquareVA, hierarchy.GetWorldTransform(m_Quads[i]));
+
 		auto textureShader = m_ShaderLibrary.Get("Texture");
 
 		m_Texture->Bind();
@@ -194,18 +266,69 @@ public:
 		RoMan::Renderer::Submit(m_Shader, m_VertexArray);
 
 		RoMan::Renderer::EndScene();
+
+		m_Framebuffer->Unbind();
+		m_PostProcess.Render(m_Framebuffer);
 	}
 
 	virtual void OnImGuiRender() override
 	{
 		ImGui::Begin("Settings");
 		ImGui::ColorEdit3("Square Color", glm::value_ptr(m_SquareColor));
+
+		bool culling = RoMan::Renderer::IsCullingEnabled();
+		if (ImGui::Checkbox("Frustum Culling", &culling))
+			RoMan::Renderer::SetCullingEnabled(culling);
+
+		if (ImGui::SliderFloat("Render Scale", &m_RenderScale, 0.25f, 1.0f))
+			m_Framebuffer->SetRenderScale(m_RenderScale);
+
+		ImGui::SliderFloat("Bloom Threshold", &m_BloomThreshold, 0.0f, 1.0f);
+		ImGui::SliderFloat("Bloom Intensity", &m_BloomIntensity, 0.0f, 2.0f);
+		ImGui::SliderFloat("Grading Strength", &m_GradingStrength, 0.0f, 1.0f);
+
+		ImGui::Separator();
+		ImGui::Text("Visible Quads: %u / %u", (uint32_t)m_VisibleQuads.size(), (uint32_t)m_Quads.size());
+		ImGui::Text("Last Click: (%.2f, %.2f)", m_PickPosition.x, m_PickPosition.y);
+		if (m_PickedQuads.empty())
+			ImGui::Text("Picked Quad: none");
+		else
+			ImGui::Text("Picked Quad: %u", m_PickedQuads.front());
 		ImGui::End();
+
+		RoMan::ImGuiPanels::PostProcessPanel(m_PostProcess);
 	}
 
 	void OnEvent(RoMan::Event& event) override
 	{
+		m_CameraController.OnEvent(event);
+
+		RoMan::EventDispatcher dispatcher(event);
+		dispatcher.Dispatch<RoMan::MouseButtonPressedEvent>(RM_BIND_EVENT_FN(ExampleLayer::OnMouseButtonPressed));
+		dispatcher.Dispatch<RoMan::WindowResizeEvent>(RM_BIND_EVENT_FN(ExampleLayer::OnWindowResized));
+	}
+
+	bool OnWindowResized(RoMan::WindowResizeEvent& event)
+	{
+		// Minimizing reports 0x0, keep the framebuffer until the window comes back
+		if (event.GetWidth() == 0 || event.GetHeight() == 0)
+			return false;
 
+		m_Framebuffer->Resize(event.GetWidth(), event.GetHeight());
+		return false;
+	}
+
+	bool OnMouseButtonPressed(RoMan::MouseButtonPressedEvent& event)
+	{
+		auto& window = RoMan::Application::Get().GetWindow();
+		auto [mouseX, mouseY] = RoMan::Input::GetMousePosition();
+		glm::vec2 position = m_CameraController.GetCamera().ScreenToWorld({ mouseX, mouseY }, { (float)window.GetWidth(), (float)window.GetHeight() });
+
+		m_PickedQuads.clear();
+		m_QuadIndex.QueryPoint(position, m_PickedQuads);
+		m_PickPosition = position;
+
+		return false;
 	}
 
 private:
@@ -219,12 +342,26 @@ private:
 
 	RoMan::Ref<RoMan::Texture2D> m_Texture, m_RITlogoTexture;
 
-	RoMan::OrthographicCamera m_Camera;
-	glm::vec3 m_CameraPosition;
-	float m_CameraMoveSpeed = 2.5f;
+	RoMan::Ref<RoMan::Framebuffer> m_Framebuffer;
+	float m_RenderScale = 1.0f;
+
+	RoMan::PostProcessStack m_PostProcess;
+	RoMan::Ref<RoMan::Texture2D> m_ColorGradingLUT;
+	float m_BloomThreshold = 0.6f;
+	float m_BloomIntensity = 0.8f;
+	float m_GradingStrength = 1.0f;
+
+	RoMan::Scene m_Scene;
+	RoMan::EntityID m_Grid;
+	std::vector<RoMan::EntityID> m_Quads;
 
-	float m_CameraRotation = 0.0f;
-	float m_CameraRotationspeed = 10.0f;
+	RoMan::SpatialGrid m_QuadIndex{ 0.5f };
+	std::vector<uint32_t> m_QuadItems;
+	std::vector<uint32_t> m_VisibleQuads;
+	std::vector<uint32_t> m_PickedQuads;
+	glm::vec2 m_PickPosition = { 0.0f, 0.0f };
+
+	RoMan::OrthographicCameraController m_CameraController;
 
 	glm::vec3 m_SquareColor = { 0.2f, 0.3f, 0.8f };
 };
@@ -235,6 +372,9 @@ class Colosseum : public RoMan::Application
 public:
 	Colosseum()
 	{
+		// Built with RoManPack, without it assets load from the loose files
+		RoMan::VirtualFileSystem::Mount("Colosseum.rmpak");
+
 		PushLayer(new ExampleLayer());
 	}
 
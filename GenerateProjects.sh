@@ -0,0 +1,3 @@
+#!/bin/sh
+# premake5 is not vendored for Linux, it has to be on the PATH
+premake5 gmake2
@@ -0,0 +1,239 @@
+#include "rmpch.h"
+#include "GLFWWindow.h"
+
+#include "RoMan/Events/ApplicationEvent.h"
+#include "RoMan/Events/KeyEvent.h"
+#include "RoMan/Events/MouseEvent.h"
+
+#include "RoMan/Renderer/Renderer.h"
+
+namespace RoMan
+{
+	static bool s_GLFWInitialized = false;
+	static uint32_t s_GLFWWindowCount = 0;
+
+	static void GLFWErrorCallback(int error, const char* description)
+	{
+		RM_CORE_ERROR("GLFW Error ({0}): {1}", error, description);
+	}
+
+	GLFWWindow::~GLFWWindow()
+	{
+		Shutdown();
+	}
+
+	bool GLFWWindow::InitGLFW()
+	{
+		if (s_GLFWInitialized)
+			return true;
+
+		glfwSetErrorCallback(GLFWErrorCallback);
+		if (!glfwInit())
+		{
+			RM_CORE_ERROR("Could not initialize GLFW!");
+			return false;
+		}
+
+		s_GLFWInitialized = true;
+		return true;
+	}
+
+	void GLFWWindow::TerminateGLFW()
+	{
+		// GLFW is shared by every window, it goes with the last one
+		if (!s_GLFWInitialized || s_GLFWWindowCount > 0)
+			return;
+
+		glfwTerminate();
+		s_GLFWInitialized = false;
+	}
+
+	void GLFWWindow::InitHeadless(const WindowProps& props, GraphicsContext* context)
+	{
+		m_Data.Title = props.Title;
+		m_Data.Height = props.Height;
+		m_Data.Width = props.Width;
+
+		RM_CORE_INFO("Creating headless window {0} ({1}, {2})", props.Title, props.Width, props.Height);
+
+		m_Context = context;
+		m_Context->Init();
+	}
+
+	bool GLFWWindow::Init(const WindowProps& props)
+	{
+		m_Data.Title = props.Title;
+		m_Data.Height = props.Height;
+		m_Data.Width = props.Width;
+
+		RM_CORE_INFO("Creating window {0} ({1}, {2})", props.Title, props.Width, props.Height);
+
+		if (!InitGLFW())
+			return false;
+
+		m_Window = glfwCreateWindow((int)props.Width, (int)props.Height, m_Data.Title.c_str(), nullptr, nullptr);
+		if (!m_Window)
+		{
+			RM_CORE_ERROR("Could not create window {0}!", props.Title);
+			TerminateGLFW();
+			return false;
+		}
+		s_GLFWWindowCount++;
+
+		m_Context = GraphicsContext::Create(m_Window);
+		m_Context->Init();
+
+		glfwSetWindowUserPointer(m_Window, &m_Data);
+		SetVSync(true);
+
+		// Set GLFW callbacks
+		glfwSetWindowSizeCallback(m_Window, [](GLFWwindow* window, int width, int height)
+			{
+				WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+				data.Width = width;
+				data.Height = height;
+
+				WindowResizeEvent event(width, height);
+				data.EventCallback(event);
+			});
+
+		glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window)
+			{
+				WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+				WindowCloseEvent event;
+				data.EventCallback(event);
+			});
+
+		glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int scancode, int action, int mods)
+			{
+				WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+
+				switch (action)
+				{
+				case GLFW_PRESS:
+				{
+					KeyPressedEvent event(key, 0);
+					data.EventCallback(event);
+					break;
+				}
+				case GLFW_RELEASE:
+				{
+					KeyReleasedEvent event(key);
+					data.EventCallback(event);
+					break;
+				}
+				case GLFW_REPEAT:
+				{
+					KeyPressedEvent event(key, 1);
+					data.EventCallback(event);
+					break;
+				}
+				}
+			});
+
+		glfwSetCharCallback(m_Window, [](GLFWwindow* window, unsigned int keycode)
+			{
+				WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+
+				KeyTypedEvent event(keycode);
+				data.EventCallback(event);
+			});
+
+		glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int mods)
+			{
+				WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+
+				switch (action)
+				{
+				case GLFW_PRESS:
+				{
+					MouseButtonPressedEvent event(button);
+					data.EventCallback(event);
+					break;
+				}
+				case GLFW_RELEASE:
+				{
+					MouseButtonReleasedEvent event(button);
+					data.EventCallback(event);
+					break;
+				}
+				}
+			});
+
+		glfwSetScrollCallback(m_Window, [](GLFWwindow* window, double xOffset, double yOffset)
+			{
+				WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+
+				MouseScrolledEvent event((float)xOffset, (float)yOffset);
+				data.EventCallback(event);
+			});
+
+		glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xPos, double yPos)
+			{
+				WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+
+				MouseMovedEvent event((float)xPos, (float)yPos);
+				data.EventCallback(event);
+			});
+
+		return true;
+	}
+
+	void GLFWWindow::Shutdown()
+	{
+		delete m_Context;
+		if (m_Window)
+		{
+			glfwDestroyWindow(m_Window);
+			s_GLFWWindowCount--;
+		}
+		TerminateGLFW();
+	}
+
+	void GLFWWindow::OnUpdate()
+	{
+		if (m_Window)
+			glfwPollEvents();
+		m_Context->SwapBuffers();
+	}
+
+	void GLFWWindow::SetVSync(bool enabled)
+	{
+		m_Data.VSync = enabled;
+		UpdateSwapInterval();
+	}
+
+	bool GLFWWindow::IsVSync() const
+	{
+		return m_Data.VSync;
+	}
+
+	void GLFWWindow::SetAdaptiveVSync(bool enabled)
+	{
+		m_Data.AdaptiveVSync = enabled;
+		UpdateSwapInterval();
+	}
+
+	bool GLFWWindow::IsAdaptiveVSync() const
+	{
+		return m_Data.AdaptiveVSync;
+	}
+
+	void GLFWWindow::UpdateSwapInterval()
+	{
+		// The swap interval applies to the current OpenGL context of a GLFW window only
+		if (!(m_Window && Renderer::GetAPI() == RendererAPI::API::OpenGL))
+			return;
+
+		int interval = m_Data.VSync ? 1 : 0;
+		if (m_Data.VSync && m_Data.AdaptiveVSync)
+		{
+			if (glfwExtensionSupported(GetSwapControlTearExtension()))
+				interval = -1;
+			else
+				RM_CORE_WARN("Adaptive VSync is not supported, falling back to regular VSync");
+		}
+
+		glfwSwapInterval(interval);
+	}
+}
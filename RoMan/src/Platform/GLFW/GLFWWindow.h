@@ -0,0 +1,65 @@
+#pragma once
+
+#include "RoMan/Window.h"
+#include "RoMan/Renderer/GraphicsContext.h"
+
+#include <GLFW/glfw3.h>
+
+namespace RoMan
+{
+	// The GLFW window and event forwarding every desktop platform shares. A platform's constructor
+	// sets its window hints and calls Init, or InitHeadless when there is no display to open one on.
+	class GLFWWindow : public Window
+	{
+	public:
+		virtual ~GLFWWindow();
+
+		void OnUpdate() override;
+
+		inline unsigned int GetWidth() const override { return m_Data.Width; }
+		inline unsigned int GetHeight() const override { return m_Data.Height; }
+
+		// Window attributes
+		inline void SetEventCallback(const EventCallbackFn& callback) override { m_Data.EventCallback = callback; }
+		void SetVSync(bool enabled) override;
+		bool IsVSync() const override;
+		void SetAdaptiveVSync(bool enabled) override;
+		bool IsAdaptiveVSync() const override;
+
+		inline virtual void* GetNativeWindow() const override { return m_Window; }
+
+	protected:
+		// Window hints are reset by glfwInit, set them after this
+		static bool InitGLFW();
+		// Terminates GLFW once no window is left
+		static void TerminateGLFW();
+
+		// False when GLFW or the window couldn't be created, the platform then falls back or gives up
+		bool Init(const WindowProps& props);
+		// No window and no input, the context renders offscreen
+		void InitHeadless(const WindowProps& props, GraphicsContext* context);
+
+		// The platform's swap_control_tear extension, e.g. "GLX_EXT_swap_control_tear"
+		virtual const char* GetSwapControlTearExtension() const = 0;
+
+	private:
+		void Shutdown();
+		void UpdateSwapInterval();
+
+	private:
+		GLFWwindow* m_Window = nullptr;
+		GraphicsContext* m_Context = nullptr;
+
+		struct WindowData
+		{
+			std::string Title;
+			unsigned int Width, Height;
+			bool VSync = false;
+			bool AdaptiveVSync = false;
+
+			EventCallbackFn EventCallback;
+		};
+
+		WindowData m_Data;
+	};
+}
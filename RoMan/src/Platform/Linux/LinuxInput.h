@@ -0,0 +1,20 @@
+#pragma once
+
+#include "RoMan/Input.h"
+
+namespace RoMan
+{
+	class LinuxInput : public Input
+	{
+	protected:
+		virtual bool IsKeyPressedImpl(int keycode);
+
+		virtual bool IsMouseButtonPressedImpl(int button);
+		virtual std::pair<float, float> GetMousePositionImpl();
+		virtual float GetMouseXImpl();
+		virtual float GetMouseYImpl();
+	};
+}
+
+
+
@@ -0,0 +1,49 @@
+#include "rmpch.h"
+#include "RoMan/Core/MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace RoMan
+{
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		int fd = open(filepath.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0)
+		{
+			close(fd);
+			return false;
+		}
+
+		void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		// The mapping keeps the file alive
+		close(fd);
+
+		if (data == MAP_FAILED)
+		{
+			RM_CORE_ERROR("Couldn't map file {0}", filepath);
+			return false;
+		}
+
+		m_Data = (const uint8_t*)data;
+		m_Size = (uint64_t)info.st_size;
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			munmap((void*)m_Data, (size_t)m_Size);
+
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+}
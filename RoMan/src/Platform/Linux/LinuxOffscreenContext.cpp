@@ -0,0 +1,127 @@
+#include "rmpch.h"
+#include "LinuxOffscreenContext.h"
+
+#include <glad/glad.h>
+
+// Keep Xlib out, its macros (None, Bool, ...) collide with engine names
+#define EGL_NO_X11
+#define MESA_EGL_NO_X11_HEADERS
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <cstring>
+
+namespace RoMan
+{
+	static bool HasClientExtension(const char* extension)
+	{
+		const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		return extensions && strstr(extensions, extension);
+	}
+
+	LinuxOffscreenContext::LinuxOffscreenContext(uint32_t width, uint32_t height)
+		:m_Width(width), m_Height(height)
+	{
+	}
+
+	LinuxOffscreenContext::~LinuxOffscreenContext()
+	{
+		if (!m_Display)
+			return;
+
+		eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if (m_Context)
+			eglDestroyContext(m_Display, m_Context);
+		if (m_Surface)
+			eglDestroySurface(m_Display, m_Surface);
+		eglTerminate(m_Display);
+	}
+
+	void* LinuxOffscreenContext::GetDisplay()
+	{
+		auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+		if (getPlatformDisplay && HasClientExtension("EGL_MESA_platform_surfaceless"))
+		{
+			EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+			if (display != EGL_NO_DISPLAY)
+				return display;
+		}
+
+		auto queryDevices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+		if (getPlatformDisplay && queryDevices && HasClientExtension("EGL_EXT_platform_device"))
+		{
+			EGLDeviceEXT device;
+			EGLint deviceCount = 0;
+			if (queryDevices(1, &device, &deviceCount) && deviceCount > 0)
+			{
+				EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+				if (display != EGL_NO_DISPLAY)
+					return display;
+			}
+		}
+
+		return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+
+	void LinuxOffscreenContext::Init()
+	{
+		m_Display = GetDisplay();
+		RM_CORE_ASSERT(m_Display != EGL_NO_DISPLAY, "Failed to get an EGL display!");
+
+		EGLint major, minor;
+		EGLBoolean success = eglInitialize(m_Display, &major, &minor);
+		RM_CORE_ASSERT(success, "Failed to initialize EGL!");
+
+		const EGLint configAttribs[] = {
+			EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8,
+			EGL_GREEN_SIZE, 8,
+			EGL_BLUE_SIZE, 8,
+			EGL_ALPHA_SIZE, 8,
+			EGL_DEPTH_SIZE, 24,
+			EGL_NONE
+		};
+
+		EGLConfig config;
+		EGLint configCount = 0;
+		eglChooseConfig(m_Display, configAttribs, &config, 1, &configCount);
+		RM_CORE_ASSERT(configCount > 0, "No EGL config supports offscreen OpenGL rendering!");
+
+		const EGLint surfaceAttribs[] = {
+			EGL_WIDTH, (EGLint)m_Width,
+			EGL_HEIGHT, (EGLint)m_Height,
+			EGL_NONE
+		};
+		m_Surface = eglCreatePbufferSurface(m_Display, config, surfaceAttribs);
+		RM_CORE_ASSERT(m_Surface != EGL_NO_SURFACE, "Failed to create EGL pbuffer surface!");
+
+		eglBindAPI(EGL_OPENGL_API);
+
+		// The OpenGL backend relies on direct state access, so ask for 4.5 core
+		const EGLint contextAttribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 4,
+			EGL_CONTEXT_MINOR_VERSION, 5,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		m_Context = eglCreateContext(m_Display, config, EGL_NO_CONTEXT, contextAttribs);
+		RM_CORE_ASSERT(m_Context != EGL_NO_CONTEXT, "Failed to create EGL context!");
+
+		eglMakeCurrent(m_Display, m_Surface, m_Surface, m_Context);
+
+		int status = gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+		RM_CORE_ASSERT(status, "Failed to initialize Glad");
+
+		RM_CORE_INFO("OpenGL Info (EGL {0}.{1} offscreen):", major, minor);
+		RM_CORE_INFO(" Vendor: {0}", (const char*)glGetString(GL_VENDOR));
+		RM_CORE_INFO(" Renderer: {0}", (const char*)glGetString(GL_RENDERER));
+		RM_CORE_INFO(" Version: {0}", (const char*)glGetString(GL_VERSION));
+	}
+
+	void LinuxOffscreenContext::SwapBuffers()
+	{
+		eglSwapBuffers(m_Display, m_Surface);
+	}
+}
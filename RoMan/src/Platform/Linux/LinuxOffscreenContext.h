@@ -0,0 +1,28 @@
+#pragma once
+
+#include "RoMan/Renderer/GraphicsContext.h"
+
+#include <cstdint>
+
+namespace RoMan
+{
+	// OpenGL context on an EGL pbuffer surface, needs no X server or window.
+	// Prefers the Mesa surfaceless platform or a GPU device and falls back to the default display.
+	class LinuxOffscreenContext : public GraphicsContext
+	{
+	public:
+		LinuxOffscreenContext(uint32_t width, uint32_t height);
+		virtual ~LinuxOffscreenContext();
+
+		virtual void Init() override;
+		virtual void SwapBuffers() override;
+	private:
+		void* GetDisplay();
+	private:
+		uint32_t m_Width, m_Height;
+
+		void* m_Display = nullptr;
+		void* m_Surface = nullptr;
+		void* m_Context = nullptr;
+	};
+}
@@ -0,0 +1,42 @@
+#include "rmpch.h"
+#include "LinuxWindow.h"
+
+#include "RoMan/Renderer/Renderer.h"
+
+#include "Platform/Linux/LinuxOffscreenContext.h"
+
+#include <cstdlib>
+
+namespace RoMan
+{
+	Window* Window::Create(const WindowProps& props)
+	{
+		return new LinuxWindow(props);
+	}
+
+	static bool HasDisplay()
+	{
+		const char* x11 = std::getenv("DISPLAY");
+		const char* wayland = std::getenv("WAYLAND_DISPLAY");
+		return (x11 && *x11) || (wayland && *wayland);
+	}
+
+	LinuxWindow::LinuxWindow(const WindowProps& props)
+	{
+		if (!Window::IsOffscreen() && Renderer::GetAPI() != RendererAPI::API::Null)
+		{
+			if (!HasDisplay())
+				RM_CORE_WARN("No X11 or Wayland display, rendering offscreen");
+			else if (Init(props))
+				return;
+			else
+				RM_CORE_WARN("Could not open a window, rendering offscreen");
+		}
+
+		// Headless servers have no display to open a GLFW window on, so there is no window and no input
+		if (Renderer::GetAPI() == RendererAPI::API::OpenGL)
+			InitHeadless(props, new LinuxOffscreenContext(props.Width, props.Height));
+		else
+			InitHeadless(props, GraphicsContext::Create(nullptr));
+	}
+}
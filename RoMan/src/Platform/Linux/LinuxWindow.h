@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Platform/GLFW/GLFWWindow.h"
+
+namespace RoMan
+{
+	class LinuxWindow : public GLFWWindow
+	{
+	public:
+		LinuxWindow(const WindowProps& props);
+
+	protected:
+		virtual const char* GetSwapControlTearExtension() const override { return "GLX_EXT_swap_control_tear"; }
+	};
+}
@@ -0,0 +1,50 @@
+#include "rmpch.h"
+#include "NullBuffer.h"
+
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+namespace RoMan
+{
+	///////////////////////////////////////////////////////////////////////////////
+	///////////////////// Vertex Buffer ////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////
+
+	NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size)
+		:m_Size(size)
+	{
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::VertexBuffer, this, m_Size);
+	}
+	NullVertexBuffer::~NullVertexBuffer()
+	{
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::VertexBuffer, this);
+	}
+	void NullVertexBuffer::Bind() const
+	{
+		FrameStats::RecordStateChange();
+	}
+	void NullVertexBuffer::UnBind() const
+	{
+	}
+
+	///////////////////////////////////////////////////////////////////////////////
+	///////////////////// Index Buffer ////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////
+
+	NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+		:m_Count(count)
+	{
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::IndexBuffer, this, m_Count * sizeof(uint32_t));
+	}
+	NullIndexBuffer::~NullIndexBuffer()
+	{
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::IndexBuffer, this);
+	}
+	void NullIndexBuffer::Bind() const
+	{
+		FrameStats::RecordStateChange();
+	}
+	void NullIndexBuffer::UnBind() const
+	{
+	}
+}
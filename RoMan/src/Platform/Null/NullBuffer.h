@@ -0,0 +1,43 @@
+#pragma once
+
+#include "RoMan/Renderer/Buffer.h"
+
+namespace RoMan
+{
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullVertexBuffer(float* vertices, uint32_t size);
+		virtual ~NullVertexBuffer();
+
+		virtual void Bind() const override;
+		virtual void UnBind() const override;
+
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+
+		// Nothing to look up on the Null backend, so its resources have no handles
+		virtual BufferHandle GetHandle() const override { return {}; }
+
+	private:
+		uint32_t m_Size;
+		BufferLayout m_Layout;
+	};
+
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer(uint32_t* indices, uint32_t count);
+		virtual ~NullIndexBuffer();
+
+		virtual void Bind() const override;
+		virtual void UnBind() const override;
+
+		virtual uint32_t GetCount() const override { return m_Count; }
+
+		virtual BufferHandle GetHandle() const override { return {}; }
+
+	private:
+		uint32_t m_Count;
+	};
+}
@@ -0,0 +1,13 @@
+#include "rmpch.h"
+#include "NullContext.h"
+
+namespace RoMan
+{
+	void NullContext::Init()
+	{
+		RM_CORE_INFO("Null graphics context, no GPU is used");
+	}
+	void NullContext::SwapBuffers()
+	{
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "RoMan/Renderer/GraphicsContext.h"
+
+namespace RoMan
+{
+	class NullContext : public GraphicsContext
+	{
+	public:
+		virtual void Init() override;
+		virtual void SwapBuffers() override;
+	};
+}
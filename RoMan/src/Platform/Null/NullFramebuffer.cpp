@@ -0,0 +1,72 @@
+#include "rmpch.h"
+#include "NullFramebuffer.h"
+
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+namespace RoMan
+{
+	NullFramebuffer::NullFramebuffer(const FramebufferSpecification& specification)
+		:m_Specification(specification)
+	{
+		RM_CORE_ASSERT(m_Specification.Samples >= 1, "Framebuffer needs at least one sample!");
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::Texture, this, GetMemorySize());
+	}
+
+	NullFramebuffer::~NullFramebuffer()
+	{
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::Texture, this);
+	}
+
+	void NullFramebuffer::Invalidate()
+	{
+		// Only the size changed, re-account the attachments
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::Texture, this);
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::Texture, this, GetMemorySize());
+	}
+
+	void NullFramebuffer::Bind()
+	{
+		FrameStats::RecordStateChange();
+	}
+
+	void NullFramebuffer::Unbind()
+	{
+		FrameStats::RecordStateChange();
+	}
+
+	void NullFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || width > MaxFramebufferSize || height > MaxFramebufferSize)
+		{
+			RM_CORE_WARN("Attempted to resize framebuffer to {0}, {1}", width, height);
+			return;
+		}
+
+		if (width == m_Specification.Width && height == m_Specification.Height)
+			return;
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+		Invalidate();
+	}
+
+	void NullFramebuffer::SetRenderScale(float scale)
+	{
+		scale = std::clamp(scale, 0.1f, 2.0f);
+		if (scale == m_Specification.RenderScale)
+			return;
+
+		m_Specification.RenderScale = scale;
+		Invalidate();
+	}
+
+	void NullFramebuffer::BlitToScreen() const
+	{
+	}
+
+	void NullFramebuffer::BindColorAttachment(uint32_t index, uint32_t slot) const
+	{
+		FrameStats::RecordStateChange();
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "RoMan/Renderer/Framebuffer.h"
+
+namespace RoMan
+{
+	// Keeps sizes and memory accounting like the OpenGL framebuffer, without any attachments
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+		NullFramebuffer(const FramebufferSpecification& specification);
+		virtual ~NullFramebuffer();
+
+		virtual void Bind() override;
+		virtual void Unbind() override;
+
+		virtual void Resize(uint32_t width, uint32_t height) override;
+		virtual void SetRenderScale(float scale) override;
+
+		virtual void BlitToScreen() const override;
+
+		virtual TextureHandle GetColorAttachment(uint32_t index = 0) const override { return {}; }
+		virtual void BindColorAttachment(uint32_t index = 0, uint32_t slot = 0) const override;
+
+		virtual uint64_t GetMemorySize() const override { return m_Specification.GetMemorySize(); }
+
+		virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+	private:
+		void Invalidate();
+
+	private:
+		FramebufferSpecification m_Specification;
+	};
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "RoMan/Renderer/GPUTimer.h"
+
+namespace RoMan
+{
+	// Nothing is drawn, so nothing takes time
+	class NullGPUTimer : public GPUTimer
+	{
+	public:
+		virtual void Begin() override {}
+		virtual void End() override {}
+
+		virtual float GetMilliseconds() const override { return 0.0f; }
+	};
+}
@@ -0,0 +1,29 @@
+#include "rmpch.h"
+#include "NullRendererAPI.h"
+
+#include "RoMan/Core/FrameStats.h"
+
+namespace RoMan
+{
+	void NullRendererAPI::Init()
+	{
+		RM_CORE_INFO("Using Null renderer, no GPU commands will be issued");
+	}
+	void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		FrameStats::RecordStateChange();
+	}
+	void NullRendererAPI::SetClearColor(const glm::vec4& color)
+	{
+		m_ClearColor = color;
+	}
+	void NullRendererAPI::Clear()
+	{
+		FrameStats::RecordStateChange();
+	}
+	void NullRendererAPI::DrawIndexed(const DrawIndexedCommand& command)
+	{
+		RM_CORE_ASSERT(command.IndexCount, "Drawing without indices!");
+		FrameStats::RecordStateChange();
+	}
+}
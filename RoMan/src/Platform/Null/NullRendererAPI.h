@@ -0,0 +1,23 @@
+#pragma once
+#include "RoMan/Renderer/RendererAPI.h"
+
+namespace RoMan
+{
+	// Renderer backend that performs all engine-side work but issues no GPU calls.
+	// Used for measuring the CPU cost of the renderer on machines without a GPU.
+	class NullRendererAPI : public RendererAPI
+	{
+	public:
+		virtual void Init() override;
+
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+		virtual void SetClearColor(const glm::vec4& color) override;
+		virtual void Clear() override;
+
+		virtual void DrawIndexed(const DrawIndexedCommand& command) override;
+
+	private:
+		glm::vec4 m_ClearColor = { 0.0f, 0.0f, 0.0f, 1.0f };
+	};
+}
@@ -0,0 +1,30 @@
+#include "rmpch.h"
+#include "NullShader.h"
+
+#include "RoMan/Core/FrameStats.h"
+
+
+namespace RoMan
+{
+	NullShader::NullShader(const std::string& filepath)
+		:m_Name(GetNameFromPath(filepath))
+	{
+		LoadStageSources(filepath, m_Sources);
+	}
+
+	NullShader::NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+		:m_Name(name)
+	{
+		m_Sources.emplace_back(ShaderStage::Vertex, vertexSrc);
+		m_Sources.emplace_back(ShaderStage::Fragment, fragmentSrc);
+	}
+
+	void NullShader::Bind() const
+	{
+		FrameStats::RecordStateChange();
+	}
+
+	void NullShader::UnBind() const
+	{
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "RoMan/Renderer/Shader.h"
+
+namespace RoMan
+{
+	class NullShader : public Shader
+	{
+	public:
+		NullShader(const std::string& filepath);
+		NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+		virtual ~NullShader() = default;
+
+		virtual void Bind() const override;
+		virtual void UnBind() const override;
+
+		virtual void SetInt(const char* name, int value) override {}
+		virtual void SetFloat(const char* name, float value) override {}
+		virtual void SetFloat2(const char* name, const glm::vec2& value) override {}
+		virtual void SetFloat3(const char* name, const glm::vec3& value) override {}
+		virtual void SetFloat4(const char* name, const glm::vec4& value) override {}
+		virtual void SetMat4(const char* name, const glm::mat4& value) override {}
+
+		virtual const std::string& GetName() const override { return m_Name; }
+		virtual ShaderHandle GetHandle() const override { return {}; }
+
+	private:
+		std::string m_Name;
+		ShaderStageSources m_Sources;
+	};
+}
@@ -0,0 +1,70 @@
+#include "rmpch.h"
+
+#include "NullTexture.h"
+
+#include "RoMan/Asset/CookedFormats.h"
+#include "RoMan/Asset/VirtualFileSystem.h"
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+#include "stb_image.h"
+
+namespace RoMan
+{
+	// Same staging as the OpenGL backend, strips are still decompressed
+	static constexpr size_t StagingBudget = 8 * 1024 * 1024;
+	static std::vector<uint8_t> s_StagingBuffer;
+
+	NullTexture2D::NullTexture2D(const std::string& path)
+		:m_Path(path)
+	{
+		FileData file = VirtualFileSystem::MapFile(path);
+		RM_CORE_ASSERT(file, "Couldn't open texture file!");
+
+		if (IsCookedTexture(file.Data, file.Size))
+		{
+			CookedTexture cooked;
+			bool valid = ReadCookedTexture(file.Data, file.Size, cooked);
+			RM_CORE_ASSERT(valid, "Invalid cooked texture!");
+
+			m_Width = cooked.Header->Width;
+			m_Height = cooked.Header->Height;
+
+			bool streamed = StreamCookedTexture(cooked, s_StagingBuffer, StagingBudget, [](uint32_t, uint32_t, uint32_t, const uint8_t*) {});
+			RM_CORE_ASSERT(streamed, "Failed to stream cooked texture!");
+
+			m_Size = 0;
+			for (uint32_t level = 0; level < cooked.Header->MipCount; level++)
+				m_Size += cooked.Mips[level].Size;
+		}
+		else
+		{
+			// Decoding is engine-side work, so it is still done even though nothing gets uploaded
+			int width, height, channels;
+			stbi_set_flip_vertically_on_load(1);
+			stbi_uc* data = stbi_load_from_memory(file.Data, (int)file.Size, &width, &height, &channels, 0);
+			RM_CORE_ASSERT(data, "Failed to load texture image!");
+
+			m_Width = width;
+			m_Height = height;
+
+			RM_CORE_ASSERT(channels == 3 || channels == 4, "Format Not Supported!");
+
+			stbi_image_free(data);
+
+			m_Size = (uint64_t)m_Width * m_Height * channels;
+		}
+
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::Texture, this, m_Size);
+	}
+
+	NullTexture2D::~NullTexture2D()
+	{
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::Texture, this);
+	}
+
+	void NullTexture2D::Bind(uint32_t slot) const
+	{
+		FrameStats::RecordStateChange();
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "RoMan/Renderer/Texture.h"
+
+namespace RoMan
+{
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		NullTexture2D(const std::string& path);
+		virtual ~NullTexture2D();
+
+		virtual uint32_t GetWidth() const override { return m_Width; }
+		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint64_t GetMemorySize() const override { return m_Size; }
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual TextureHandle GetHandle() const override { return {}; }
+
+	private:
+		std::string m_Path;
+		uint32_t m_Width;
+		uint32_t m_Height;
+		uint64_t m_Size;
+	};
+}
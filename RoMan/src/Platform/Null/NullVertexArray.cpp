@@ -0,0 +1,32 @@
+#include "rmpch.h"
+#include "NullVertexArray.h"
+
+#include "RoMan/Core/FrameStats.h"
+
+namespace RoMan
+{
+	void NullVertexArray::Bind() const
+	{
+		FrameStats::RecordStateChange();
+	}
+	void NullVertexArray::UnBind() const
+	{
+	}
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		RM_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "VertexBuffer has no layout!");
+
+		vertexBuffer->Bind();
+
+		// One attribute pointer would be set up per layout element
+		m_VertexBufferIndex += (uint32_t)vertexBuffer->GetLayout().GetElements().size();
+
+		m_VertexBuffers.push_back(vertexBuffer);
+	}
+	void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+	{
+		indexBuffer->Bind();
+
+		m_IndexBuffer = indexBuffer;
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "RoMan/Renderer/VertexArray.h"
+
+namespace RoMan
+{
+	class NullVertexArray : public VertexArray
+	{
+	public:
+		NullVertexArray() = default;
+		virtual ~NullVertexArray() = default;
+
+		virtual void Bind() const override;
+		virtual void UnBind() const override;
+
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+		virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+		virtual VertexArrayHandle GetHandle() const override { return {}; }
+
+	private:
+		uint32_t m_VertexBufferIndex = 0;
+		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+		Ref<IndexBuffer> m_IndexBuffer;
+	};
+}
@@ -0,0 +1,24 @@
+#include "rmpch.h"
+#include "NullVirtualTexture.h"
+
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+namespace RoMan
+{
+	NullVirtualTexture2D::NullVirtualTexture2D(const std::string& path, const VirtualTextureSpecification& specification)
+		:VirtualTexture2D(path, specification)
+	{
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::Texture, this, GetMemorySize());
+	}
+
+	NullVirtualTexture2D::~NullVirtualTexture2D()
+	{
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::Texture, this);
+	}
+
+	void NullVirtualTexture2D::Bind(uint32_t slot) const
+	{
+		FrameStats::RecordStateChange();
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "RoMan/Renderer/VirtualTexture.h"
+
+namespace RoMan
+{
+	class NullVirtualTexture2D : public VirtualTexture2D
+	{
+	public:
+		NullVirtualTexture2D(const std::string& path, const VirtualTextureSpecification& specification);
+		virtual ~NullVirtualTexture2D();
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		virtual TextureHandle GetHandle() const override { return {}; }
+
+	protected:
+		virtual void UploadPage(uint32_t slotX, uint32_t slotY, const uint8_t* pixels) override {}
+		virtual void UploadPageTable(uint32_t level, const uint32_t* entries) override {}
+	};
+}
@@ -1,5 +1,9 @@
 #include "rmpch.h"
 #include "OpenGLBuffer.h"
+#include "OpenGLResources.h"
+
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
 
 #include "glad/glad.h"
 
@@ -11,17 +15,26 @@ namespace RoMan
 
 	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
 	{
-		glCreateBuffers(1, &m_RendererID);
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		OpenGLBufferData data;
+		data.Size = size;
+		glCreateBuffers(1, &data.RendererID);
+		glBindBuffer(GL_ARRAY_BUFFER, data.RendererID);
 		glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+
+		m_Handle = OpenGLResources::GetBuffers().Create(data);
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::VertexBuffer, this, size);
 	}
 	OpenGLVertexBuffer::~OpenGLVertexBuffer()
 	{
-		glDeleteBuffers(1, &m_RendererID);
+		glDeleteBuffers(1, &OpenGLResources::GetBuffers().Get(m_Handle).RendererID);
+		OpenGLResources::GetBuffers().Destroy(m_Handle);
+
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::VertexBuffer, this);
 	}
 	void OpenGLVertexBuffer::Bind() const
 	{
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		glBindBuffer(GL_ARRAY_BUFFER, OpenGLResources::GetBuffers().Get(m_Handle).RendererID);
+		FrameStats::RecordStateChange();
 	}
 	void OpenGLVertexBuffer::UnBind() const
 	{
@@ -35,17 +48,26 @@ namespace RoMan
 	OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count)
 		:m_Count(count)
 	{
-		glCreateBuffers(1, &m_RendererID);
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-		glBufferData(GL_ARRAY_BUFFER, m_Count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+		OpenGLBufferData data;
+		data.Size = m_Count * sizeof(uint32_t);
+		glCreateBuffers(1, &data.RendererID);
+		glBindBuffer(GL_ARRAY_BUFFER, data.RendererID);
+		glBufferData(GL_ARRAY_BUFFER, data.Size, indices, GL_STATIC_DRAW);
+
+		m_Handle = OpenGLResources::GetBuffers().Create(data);
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::IndexBuffer, this, data.Size);
 	}
 	OpenGLIndexBuffer::~OpenGLIndexBuffer()
 	{
-		glDeleteBuffers(1, &m_RendererID);
+		glDeleteBuffers(1, &OpenGLResources::GetBuffers().Get(m_Handle).RendererID);
+		OpenGLResources::GetBuffers().Destroy(m_Handle);
+
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::IndexBuffer, this);
 	}
 	void OpenGLIndexBuffer::Bind() const
 	{
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, OpenGLResources::GetBuffers().Get(m_Handle).RendererID);
+		FrameStats::RecordStateChange();
 	}
 	void OpenGLIndexBuffer::UnBind() const
 	{
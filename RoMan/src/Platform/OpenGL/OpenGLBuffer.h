@@ -16,8 +16,10 @@ namespace RoMan
 		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
 		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 
+		virtual BufferHandle GetHandle() const override { return m_Handle; }
+
 	private:
-		uint32_t m_RendererID;
+		BufferHandle m_Handle;
 		BufferLayout m_Layout;
 	};
 
@@ -32,8 +34,10 @@ namespace RoMan
 		
 		virtual uint32_t GetCount() const { return m_Count; }
 
+		virtual BufferHandle GetHandle() const override { return m_Handle; }
+
 	private:
-		uint32_t m_RendererID;
+		BufferHandle m_Handle;
 		uint32_t m_Count;
 
 	};
@@ -3,7 +3,6 @@
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
-#include <GL/GL.h>
 
 namespace RoMan
 {
@@ -19,9 +18,9 @@ namespace RoMan
 		RM_CORE_ASSERT(status, "Failed to initialize Glad");
 
 		RM_CORE_INFO("OpenGL Info:");
-		RM_CORE_INFO(" Vendor: {0}", glGetString(GL_VENDOR));
-		RM_CORE_INFO(" Renderer: {0}", glGetString(GL_RENDERER));
-		RM_CORE_INFO(" Version: {0}", glGetString(GL_VERSION));
+		RM_CORE_INFO(" Vendor: {0}", (const char*)glGetString(GL_VENDOR));
+		RM_CORE_INFO(" Renderer: {0}", (const char*)glGetString(GL_RENDERER));
+		RM_CORE_INFO(" Version: {0}", (const char*)glGetString(GL_VERSION));
 	}
 	void OpenGLContext::SwapBuffers()
 	{
@@ -0,0 +1,241 @@
+#include "rmpch.h"
+#include "OpenGLFramebuffer.h"
+#include "OpenGLResources.h"
+
+#include "RoMan/Renderer/Renderer.h"
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+#include <glad/glad.h>
+
+namespace RoMan
+{
+	static bool IsDepthFormat(FramebufferTextureFormat format)
+	{
+		return format == FramebufferTextureFormat::Depth24Stencil8;
+	}
+
+	static GLenum GetInternalFormat(FramebufferTextureFormat format)
+	{
+		switch (format)
+		{
+		case FramebufferTextureFormat::RGBA8:           return GL_RGBA8;
+		case FramebufferTextureFormat::RGBA16F:         return GL_RGBA16F;
+		case FramebufferTextureFormat::Depth24Stencil8: return GL_DEPTH24_STENCIL8;
+		case FramebufferTextureFormat::None:            break;
+		}
+
+		RM_CORE_ASSERT(false, "Unknown framebuffer texture format!");
+		return 0;
+	}
+
+	static TextureHandle CreateAttachment(uint32_t framebufferID, GLenum attachment, FramebufferTextureFormat format, uint32_t width, uint32_t height, uint32_t samples)
+	{
+		uint32_t textureID;
+		if (samples > 1)
+		{
+			glCreateTextures(GL_TEXTURE_2D_MULTISAMPLE, 1, &textureID);
+			glTextureStorage2DMultisample(textureID, samples, GetInternalFormat(format), width, height, GL_FALSE);
+		}
+		else
+		{
+			glCreateTextures(GL_TEXTURE_2D, 1, &textureID);
+			glTextureStorage2D(textureID, 1, GetInternalFormat(format), width, height);
+
+			// Linear so a scaled framebuffer can be sampled straight onto the screen
+			glTextureParameteri(textureID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(textureID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(textureID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(textureID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+
+		glNamedFramebufferTexture(framebufferID, attachment, textureID, 0);
+		return OpenGLResources::GetTextures().Create({ textureID, width, height });
+	}
+
+	static void DestroyAttachment(TextureHandle& handle)
+	{
+		if (!handle.IsValid())
+			return;
+
+		glDeleteTextures(1, &OpenGLResources::GetTextures().Get(handle).RendererID);
+		OpenGLResources::GetTextures().Destroy(handle);
+		handle = TextureHandle();
+	}
+
+	static void SetDrawBuffers(uint32_t framebufferID, uint32_t colorCount)
+	{
+		if (colorCount == 0)
+		{
+			glNamedFramebufferDrawBuffer(framebufferID, GL_NONE);
+			return;
+		}
+
+		GLenum buffers[8];
+		for (uint32_t i = 0; i < colorCount; i++)
+			buffers[i] = GL_COLOR_ATTACHMENT0 + i;
+		glNamedFramebufferDrawBuffers(framebufferID, colorCount, buffers);
+	}
+
+	OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpecification& specification)
+		:m_Specification(specification)
+	{
+		RM_CORE_ASSERT(m_Specification.Samples >= 1, "Framebuffer needs at least one sample!");
+		Invalidate();
+	}
+
+	OpenGLFramebuffer::~OpenGLFramebuffer()
+	{
+		Release();
+	}
+
+	void OpenGLFramebuffer::Release()
+	{
+		if (!m_RendererID)
+			return;
+
+		for (TextureHandle& handle : m_ColorAttachments)
+			DestroyAttachment(handle);
+		for (TextureHandle& handle : m_ResolveAttachments)
+			DestroyAttachment(handle);
+		DestroyAttachment(m_DepthAttachment);
+		m_ColorAttachments.clear();
+		m_ResolveAttachments.clear();
+
+		glDeleteFramebuffers(1, &m_RendererID);
+		if (m_ResolveID)
+			glDeleteFramebuffers(1, &m_ResolveID);
+		m_RendererID = 0;
+		m_ResolveID = 0;
+
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::Texture, this);
+	}
+
+	void OpenGLFramebuffer::Invalidate()
+	{
+		Release();
+
+		uint32_t width = m_Specification.GetScaledWidth();
+		uint32_t height = m_Specification.GetScaledHeight();
+		uint32_t samples = m_Specification.Samples;
+
+		glCreateFramebuffers(1, &m_RendererID);
+
+		uint32_t colorCount = 0;
+		for (FramebufferTextureFormat format : m_Specification.Attachments)
+		{
+			if (IsDepthFormat(format))
+			{
+				RM_CORE_ASSERT(!m_DepthAttachment.IsValid(), "Framebuffer has more than one depth attachment!");
+				m_DepthAttachment = CreateAttachment(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, format, width, height, samples);
+			}
+			else
+			{
+				RM_CORE_ASSERT(colorCount < 8, "Framebuffer has more than 8 color attachments!");
+				m_ColorAttachments.push_back(CreateAttachment(m_RendererID, GL_COLOR_ATTACHMENT0 + colorCount, format, width, height, samples));
+				colorCount++;
+			}
+		}
+
+		SetDrawBuffers(m_RendererID, colorCount);
+		RM_CORE_ASSERT(glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
+
+		// Multisampled textures can't be sampled or scaled by a blit, they resolve into these on Unbind
+		if (samples > 1)
+		{
+			glCreateFramebuffers(1, &m_ResolveID);
+
+			uint32_t resolveCount = 0;
+			for (FramebufferTextureFormat format : m_Specification.Attachments)
+			{
+				if (IsDepthFormat(format))
+					continue;
+
+				m_ResolveAttachments.push_back(CreateAttachment(m_ResolveID, GL_COLOR_ATTACHMENT0 + resolveCount, format, width, height, 1));
+				resolveCount++;
+			}
+
+			RM_CORE_ASSERT(resolveCount == 0 || glCheckNamedFramebufferStatus(m_ResolveID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Resolve framebuffer is incomplete!");
+		}
+
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::Texture, this, GetMemorySize());
+	}
+
+	void OpenGLFramebuffer::Bind()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+		glViewport(0, 0, m_Specification.GetScaledWidth(), m_Specification.GetScaledHeight());
+		FrameStats::RecordStateChange();
+	}
+
+	void OpenGLFramebuffer::Unbind()
+	{
+		if (m_ResolveID)
+		{
+			GLint width = m_Specification.GetScaledWidth(), height = m_Specification.GetScaledHeight();
+			for (uint32_t i = 0; i < (uint32_t)m_ResolveAttachments.size(); i++)
+			{
+				glNamedFramebufferReadBuffer(m_RendererID, GL_COLOR_ATTACHMENT0 + i);
+				glNamedFramebufferDrawBuffer(m_ResolveID, GL_COLOR_ATTACHMENT0 + i);
+				glBlitNamedFramebuffer(m_RendererID, m_ResolveID, 0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+			}
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glViewport(0, 0, Renderer::GetScreenWidth(), Renderer::GetScreenHeight());
+		FrameStats::RecordStateChange();
+	}
+
+	void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || width > MaxFramebufferSize || height > MaxFramebufferSize)
+		{
+			RM_CORE_WARN("Attempted to resize framebuffer to {0}, {1}", width, height);
+			return;
+		}
+
+		if (width == m_Specification.Width && height == m_Specification.Height)
+			return;
+
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+		Invalidate();
+	}
+
+	void OpenGLFramebuffer::SetRenderScale(float scale)
+	{
+		scale = std::clamp(scale, 0.1f, 2.0f);
+		if (scale == m_Specification.RenderScale)
+			return;
+
+		m_Specification.RenderScale = scale;
+		Invalidate();
+	}
+
+	void OpenGLFramebuffer::BlitToScreen() const
+	{
+		if (m_ColorAttachments.empty())
+			return;
+
+		uint32_t source = m_ResolveID ? m_ResolveID : m_RendererID;
+		GLint width = m_Specification.GetScaledWidth(), height = m_Specification.GetScaledHeight();
+		GLint screenWidth = Renderer::GetScreenWidth(), screenHeight = Renderer::GetScreenHeight();
+
+		glNamedFramebufferReadBuffer(source, GL_COLOR_ATTACHMENT0);
+		glBlitNamedFramebuffer(source, 0, 0, 0, width, height, 0, 0, screenWidth, screenHeight, GL_COLOR_BUFFER_BIT,
+			width == screenWidth && height == screenHeight ? GL_NEAREST : GL_LINEAR);
+	}
+
+	TextureHandle OpenGLFramebuffer::GetColorAttachment(uint32_t index) const
+	{
+		const std::vector<TextureHandle>& attachments = m_ResolveID ? m_ResolveAttachments : m_ColorAttachments;
+		RM_CORE_ASSERT(index < attachments.size(), "Color attachment index out of range!");
+		return attachments[index];
+	}
+
+	void OpenGLFramebuffer::BindColorAttachment(uint32_t index, uint32_t slot) const
+	{
+		glBindTextureUnit(slot, OpenGLResources::GetTextures().Get(GetColorAttachment(index)).RendererID);
+		FrameStats::RecordStateChange();
+	}
+}
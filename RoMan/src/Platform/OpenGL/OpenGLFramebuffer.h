@@ -0,0 +1,43 @@
+#pragma once
+
+#include "RoMan/Renderer/Framebuffer.h"
+
+namespace RoMan
+{
+	class OpenGLFramebuffer : public Framebuffer
+	{
+	public:
+		OpenGLFramebuffer(const FramebufferSpecification& specification);
+		virtual ~OpenGLFramebuffer();
+
+		virtual void Bind() override;
+		virtual void Unbind() override;
+
+		virtual void Resize(uint32_t width, uint32_t height) override;
+		virtual void SetRenderScale(float scale) override;
+
+		virtual void BlitToScreen() const override;
+
+		virtual TextureHandle GetColorAttachment(uint32_t index = 0) const override;
+		virtual void BindColorAttachment(uint32_t index = 0, uint32_t slot = 0) const override;
+
+		virtual uint64_t GetMemorySize() const override { return m_Specification.GetMemorySize(); }
+
+		virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+	private:
+		// Recreates every attachment at the current scaled size
+		void Invalidate();
+		void Release();
+
+	private:
+		FramebufferSpecification m_Specification;
+		uint32_t m_RendererID = 0;
+		// Single sampled copies of the color attachments when multisampled
+		uint32_t m_ResolveID = 0;
+
+		std::vector<TextureHandle> m_ColorAttachments;
+		std::vector<TextureHandle> m_ResolveAttachments;
+		TextureHandle m_DepthAttachment;
+	};
+}
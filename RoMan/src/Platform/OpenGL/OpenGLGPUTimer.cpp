@@ -0,0 +1,52 @@
+#include "rmpch.h"
+#include "OpenGLGPUTimer.h"
+
+#include <glad/glad.h>
+
+namespace RoMan
+{
+	OpenGLGPUTimer::OpenGLGPUTimer()
+	{
+		glCreateQueries(GL_TIME_ELAPSED, QueryCount, m_Queries);
+	}
+
+	OpenGLGPUTimer::~OpenGLGPUTimer()
+	{
+		glDeleteQueries(QueryCount, m_Queries);
+	}
+
+	void OpenGLGPUTimer::Begin()
+	{
+		ReadResults();
+
+		// Every query is still pending, drop the oldest rather than stall on it
+		if (m_Issued - m_Read == QueryCount)
+			m_Read++;
+
+		glBeginQuery(GL_TIME_ELAPSED, m_Queries[m_Issued % QueryCount]);
+	}
+
+	void OpenGLGPUTimer::End()
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		m_Issued++;
+	}
+
+	void OpenGLGPUTimer::ReadResults()
+	{
+		while (m_Read < m_Issued)
+		{
+			uint32_t query = m_Queries[m_Read % QueryCount];
+
+			GLint available = 0;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+				break;
+
+			GLuint64 nanoseconds = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+			m_Milliseconds = nanoseconds / 1e6f;
+			m_Read++;
+		}
+	}
+}
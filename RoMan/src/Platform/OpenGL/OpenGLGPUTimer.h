@@ -0,0 +1,32 @@
+#pragma once
+
+#include "RoMan/Renderer/GPUTimer.h"
+
+namespace RoMan
+{
+	class OpenGLGPUTimer : public GPUTimer
+	{
+	public:
+		OpenGLGPUTimer();
+		virtual ~OpenGLGPUTimer();
+
+		virtual void Begin() override;
+		virtual void End() override;
+
+		virtual float GetMilliseconds() const override { return m_Milliseconds; }
+
+	private:
+		// Results that aren't available yet are collected on later calls
+		void ReadResults();
+
+	private:
+		// Enough for the frames the driver queues ahead
+		static constexpr uint32_t QueryCount = 4;
+
+		uint32_t m_Queries[QueryCount] = {};
+		// Queries issued and read so far, the difference is in flight
+		uint64_t m_Issued = 0;
+		uint64_t m_Read = 0;
+		float m_Milliseconds = 0.0f;
+	};
+}
@@ -1,5 +1,8 @@
 #include "rmpch.h"
 #include "OpenGLRendererAPI.h"
+#include "OpenGLResources.h"
+
+#include "RoMan/Core/FrameStats.h"
 
 #include <glad/glad.h>
 namespace RoMan
@@ -9,6 +12,10 @@ namespace RoMan
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 	}
+	void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		glViewport(x, y, width, height);
+	}
 	void OpenGLRendererAPI::SetClearColor(const glm::vec4& color)
 	{
 		glClearColor(color.r, color.g, color.b, color.a);
@@ -17,8 +24,12 @@ namespace RoMan
 	{
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	}
-	void OpenGLRendererAPI::DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray)
+	void OpenGLRendererAPI::DrawIndexed(const DrawIndexedCommand& command)
 	{
-		glDrawElements(GL_TRIANGLES, vertexArray->GetIndexBuffer()->GetCount(), GL_UNSIGNED_INT, nullptr);
+		const OpenGLVertexArrayData& vertexArray = OpenGLResources::GetVertexArrays().Get(command.VertexArray);
+		glBindVertexArray(vertexArray.RendererID);
+		FrameStats::RecordStateChange();
+
+		glDrawElements(GL_TRIANGLES, command.IndexCount, GL_UNSIGNED_INT, nullptr);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,10 @@
+#include "rmpch.h"
+#include "OpenGLResources.h"
+
+namespace RoMan
+{
+	HandlePool<OpenGLTextureData, TextureHandle> OpenGLResources::s_Textures;
+	HandlePool<OpenGLBufferData, BufferHandle> OpenGLResources::s_Buffers;
+	HandlePool<OpenGLShaderData, ShaderHandle> OpenGLResources::s_Shaders;
+	HandlePool<OpenGLVertexArrayData, VertexArrayHandle> OpenGLResources::s_VertexArrays;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "RoMan/Renderer/HandlePool.h"
+
+namespace RoMan
+{
+	struct OpenGLTextureData
+	{
+		uint32_t RendererID = 0;
+		uint32_t Width = 0, Height = 0;
+	};
+
+	struct OpenGLBufferData
+	{
+		uint32_t RendererID = 0;
+		uint32_t Size = 0;
+	};
+
+	struct OpenGLShaderData
+	{
+		uint32_t RendererID = 0;
+	};
+
+	struct OpenGLVertexArrayData
+	{
+		uint32_t RendererID = 0;
+		BufferHandle IndexBuffer;
+	};
+
+	// GL object state lives here, the OpenGL* resource classes only keep a handle into these pools
+	class OpenGLResources
+	{
+	public:
+		static HandlePool<OpenGLTextureData, TextureHandle>& GetTextures() { return s_Textures; }
+		static HandlePool<OpenGLBufferData, BufferHandle>& GetBuffers() { return s_Buffers; }
+		static HandlePool<OpenGLShaderData, ShaderHandle>& GetShaders() { return s_Shaders; }
+		static HandlePool<OpenGLVertexArrayData, VertexArrayHandle>& GetVertexArrays() { return s_VertexArrays; }
+
+	private:
+		static HandlePool<OpenGLTextureData, TextureHandle> s_Textures;
+		static HandlePool<OpenGLBufferData, BufferHandle> s_Buffers;
+		static HandlePool<OpenGLShaderData, ShaderHandle> s_Shaders;
+		static HandlePool<OpenGLVertexArrayData, VertexArrayHandle> s_VertexArrays;
+	};
+}
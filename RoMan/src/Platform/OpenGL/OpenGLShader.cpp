@@ -1,7 +1,10 @@
 #include "rmpch.h"
 #include "OpenGLShader.h"
+#include "OpenGLResources.h"
+
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/FrameAllocator.h"
 
-#include <fstream>
 
 #include "glad/glad.h"
 #include "glm/gtc/type_ptr.hpp"
@@ -9,101 +12,65 @@
 
 namespace RoMan
 {
-	static GLenum ShaderTypeFromString(const std::string& type)
+	static GLenum ShaderTypeFromStage(ShaderStage stage)
 	{
-		if (type == "vertex")
-			return GL_VERTEX_SHADER;
-		else if (type == "fragment")
-			return GL_FRAGMENT_SHADER;
+		switch (stage)
+		{
+		case ShaderStage::Vertex:   return GL_VERTEX_SHADER;
+		case ShaderStage::Fragment: return GL_FRAGMENT_SHADER;
+		}
 
 		RM_CORE_ASSERT(false, "Unknown ShaderType!");
-
 		return 0;
 	}
 
-
 	OpenGLShader::OpenGLShader(const std::string& filepath)
+		:m_Name(GetNameFromPath(filepath))
 	{
-		std::string source = ReadFile(filepath);
-		auto shaderSources = PreProcess(source);
-		Compile(shaderSources);
+		ShaderStageSources sources;
+		if (!LoadStageSources(filepath, sources))
+			return;
 
-		//Get filename from path
-		auto lastSlash = filepath.find_last_of("/\\");
-		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
-		auto lastDot = filepath.rfind('.');
-		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
-		m_Name = filepath.substr(lastSlash, count);
+		Compile(sources);
 	}
 
 	OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
 		:m_Name(name)
 	{
-		std::unordered_map<GLenum, std::string> sources;
-		sources[GL_VERTEX_SHADER] = vertexSrc;
-		sources[GL_FRAGMENT_SHADER] = fragmentSrc;
-		Compile(sources);
+		Compile({ { ShaderStage::Vertex, vertexSrc }, { ShaderStage::Fragment, fragmentSrc } });
 	}
 
 	OpenGLShader::~OpenGLShader()
 	{
-		glDeleteProgram(m_RendererID);
-	}
-
-	std::string OpenGLShader::ReadFile(const std::string& filepath)
-	{
-		std::string result;
-		std::ifstream in(filepath, std::ios::in | std::ios::binary);
-		if (in)
-		{
-			in.seekg(0, std::ios::end);
-			result.resize(in.tellg());
-			in.seekg(0, std::ios::beg);
-			in.read(&result[0], result.size());
-			in.close();
-		}
-		else
-		{
-			RM_CORE_ERROR("Couldn't open file path {0}", filepath);
-		}
+		if (!m_Handle.IsValid())
+			return;
 
-		return result;
+		glDeleteProgram(GetRendererID());
+		OpenGLResources::GetShaders().Destroy(m_Handle);
 	}
-	std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::string& source)
-	{
-		std::unordered_map < GLenum, std::string> shaderSources;
 
-		const char* typeToken = "#type";
-		size_t typeTokenLength = strlen(typeToken);
-		size_t pos = source.find(typeToken, 0);
-		while (pos != std::string::npos)
+	void OpenGLShader::Compile(const ShaderStageSources& shaderSources)
+	{
+		if (shaderSources.empty())
 		{
-			size_t eol = source.find_first_of("\r\n", pos);
-			RM_CORE_ASSERT(eol != std::string::npos, "Syntax error");
-			size_t begin = pos + typeTokenLength + 1;
-			std::string type = source.substr(begin, eol - begin);
-			RM_CORE_ASSERT(ShaderTypeFromString(type), "Invalid shader type specified");
-
-			size_t nextLinePos = source.find_first_not_of("\r\n", eol);
-			pos = source.find(typeToken, nextLinePos);
-			shaderSources[ShaderTypeFromString(type)] = source.substr(nextLinePos, pos - (nextLinePos == std::string::npos ? source.size() - 1 : nextLinePos));
+			RM_CORE_ERROR("Shader {0} has no stages, it is left empty", m_Name);
+			return;
 		}
 
-		return shaderSources;
-	}
-	void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
-	{
 		GLuint program = glCreateProgram();
 		RM_CORE_ASSERT(shaderSources.size() <= 2, "RoMan only support 2 shaders for now");
 		std::array<GLenum, 2> glShaderIDs;
 		int glShaderIDIndex = 0;
 
-		for (auto& kv : shaderSources)
+		auto deleteShaders = [&]()
 		{
-			GLenum type = kv.first;
-			const std::string& source = kv.second;
+			for (int i = 0; i < glShaderIDIndex; i++)
+				glDeleteShader(glShaderIDs[i]);
+		};
 
-			GLuint shader = glCreateShader(type);
+		for (const auto& [stage, source] : shaderSources)
+		{
+			GLuint shader = glCreateShader(ShaderTypeFromStage(stage));
 
 			const GLchar* sourceCStr = source.c_str();
 			glShaderSource(shader, 1, &sourceCStr, 0);
@@ -117,22 +84,23 @@ namespace RoMan
 				GLint maxLength = 0;
 				glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
 
-				std::vector<GLchar> infoLog(maxLength);
+				FrameVector<GLchar> infoLog(maxLength);
 				glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
 
+				// Don't link what compiled so far, the shader stays without a program
 				glDeleteShader(shader);
+				deleteShaders();
+				glDeleteProgram(program);
 
 				RM_CORE_ERROR("{0}", infoLog.data());
 				RM_CORE_ASSERT(false, "Shader compilation failure!");
-				break;
+				return;
 			}
 
 			glAttachShader(program, shader);
 			glShaderIDs[glShaderIDIndex++] = shader;
 		}
 
-		m_RendererID = program;
-
 		// Link our program
 		glLinkProgram(program);
 
@@ -145,27 +113,38 @@ namespace RoMan
 			glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
 
 			// The maxLength includes the NULL character
-			std::vector<GLchar> infoLog(maxLength);
+			FrameVector<GLchar> infoLog(maxLength);
 			glGetProgramInfoLog(program, maxLength, &maxLength, &infoLog[0]);
 
 			// We don't need the program anymore.
 			glDeleteProgram(program);
-
-			for (auto id : glShaderIDs)
-				glDeleteShader(id);
+			deleteShaders();
 
 			RM_CORE_ERROR("{0}", infoLog.data());
 			RM_CORE_ASSERT(false, "Shader link failure!");
 			return;
 		}
 
-		for (auto id : glShaderIDs)
-			glDetachShader(program, id);
+		for (int i = 0; i < glShaderIDIndex; i++)
+		{
+			glDetachShader(program, glShaderIDs[i]);
+			glDeleteShader(glShaderIDs[i]);
+		}
+
+		// Only a linked program gets a handle, a failed shader owns nothing
+		m_Handle = OpenGLResources::GetShaders().Create({ program });
+	}
+
+	uint32_t OpenGLShader::GetRendererID() const
+	{
+		// A shader that failed to build binds program 0
+		return m_Handle.IsValid() ? OpenGLResources::GetShaders().Get(m_Handle).RendererID : 0;
 	}
 
 	void OpenGLShader::Bind() const
 	{
-		glUseProgram(m_RendererID);
+		glUseProgram(GetRendererID());
+		FrameStats::RecordStateChange();
 	}
 
 	void OpenGLShader::UnBind() const
@@ -173,45 +152,75 @@ namespace RoMan
 		glUseProgram(0);
 	}
 
-	void OpenGLShader::UploadUniformInt(const std::string& name, int value)
+	void OpenGLShader::SetInt(const char* name, int value)
+	{
+		UploadUniformInt(name, value);
+	}
+
+	void OpenGLShader::SetFloat(const char* name, float value)
+	{
+		UploadUniformFloat(name, value);
+	}
+
+	void OpenGLShader::SetFloat2(const char* name, const glm::vec2& value)
+	{
+		UploadUniformFloat2(name, value);
+	}
+
+	void OpenGLShader::SetFloat3(const char* name, const glm::vec3& value)
+	{
+		UploadUniformFloat3(name, value);
+	}
+
+	void OpenGLShader::SetFloat4(const char* name, const glm::vec4& value)
+	{
+		UploadUniformFloat4(name, value);
+	}
+
+	void OpenGLShader::SetMat4(const char* name, const glm::mat4& value)
+	{
+		UploadUniformMatrix4(name, value);
+	}
+
+	void OpenGLShader::UploadUniformInt(const char* name, int value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = glGetUniformLocation(GetRendererID(), name);
 		glUniform1i(location, value);
 	}
 
-	void OpenGLShader::UploadUniformFloat(const std::string& name, float value)
+	void OpenGLShader::UploadUniformFloat(const char* name, float value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = glGetUniformLocation(GetRendererID(), name);
 		glUniform1f(location, value);
 	}
 
-	void OpenGLShader::UploadUniformFloat2(const std::string& name, glm::vec2& value)
+	void OpenGLShader::UploadUniformFloat2(const char* name, const glm::vec2& value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = glGetUniformLocation(GetRendererID(), name);
 		glUniform2f(location, value.x, value.y);
 	}
 
-	void OpenGLShader::UploadUniformFloat3(const std::string& name, glm::vec3& value)
+	void OpenGLShader::UploadUniformFloat3(const char* name, const glm::vec3& value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = glGetUniformLocation(GetRendererID(), name);
 		glUniform3f(location, value.x, value.y, value.z);
 	}
 
-	void OpenGLShader::UploadUniformFloat4(const std::string& name, glm::vec4& value)
+	void OpenGLShader::UploadUniformFloat4(const char* name, const glm::vec4& value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = glGetUniformLocation(GetRendererID(), name);
 		glUniform4f(location, value.x, value.y, value.z, value.w);
 	}
 
-	void OpenGLShader::UploadUniformMatrix3(const std::string& name, const glm::mat3& matrix)
+	void OpenGLShader::UploadUniformMatrix3(const char* name, const glm::mat3& matrix)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = glGetUniformLocation(GetRendererID(), name);
 		glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
-	void OpenGLShader::UploadUniformMatrix4(const std::string& name, const glm::mat4& matrix)
+	void OpenGLShader::UploadUniformMatrix4(const char* name, const glm::mat4& matrix)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = glGetUniformLocation(GetRendererID(), name);
 		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
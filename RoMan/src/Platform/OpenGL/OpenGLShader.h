@@ -3,9 +3,6 @@
 
 #include "glm/glm.hpp"
 
-//TODO: Remove
-typedef unsigned int GLenum;
-
 namespace RoMan
 {
 	class OpenGLShader : public Shader
@@ -15,27 +12,34 @@ namespace RoMan
 		OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
 		virtual ~OpenGLShader();
 
-		void Bind() const;
-		void UnBind() const;
+		virtual void Bind() const override;
+		virtual void UnBind() const override;
+
+		virtual void SetInt(const char* name, int value) override;
+		virtual void SetFloat(const char* name, float value) override;
+		virtual void SetFloat2(const char* name, const glm::vec2& value) override;
+		virtual void SetFloat3(const char* name, const glm::vec3& value) override;
+		virtual void SetFloat4(const char* name, const glm::vec4& value) override;
+		virtual void SetMat4(const char* name, const glm::mat4& value) override;
 
 		virtual const std::string& GetName() const override { return m_Name; }
+		virtual ShaderHandle GetHandle() const override { return m_Handle; }
 
-		void UploadUniformInt(const std::string& name, int value);
+		void UploadUniformInt(const char* name, int value);
 
-		void UploadUniformFloat(const std::string& name, float value);
-		void UploadUniformFloat2(const std::string& name, glm::vec2& value);
-		void UploadUniformFloat3(const std::string& name, glm::vec3& value);
-		void UploadUniformFloat4(const std::string& name, glm::vec4& value);
+		void UploadUniformFloat(const char* name, float value);
+		void UploadUniformFloat2(const char* name, const glm::vec2& value);
+		void UploadUniformFloat3(const char* name, const glm::vec3& value);
+		void UploadUniformFloat4(const char* name, const glm::vec4& value);
 
-		void UploadUniformMatrix3(const std::string& name, const glm::mat3& matrix);
-		void UploadUniformMatrix4(const std::string& name, const glm::mat4& matrix);
+		void UploadUniformMatrix3(const char* name, const glm::mat3& matrix);
+		void UploadUniformMatrix4(const char* name, const glm::mat4& matrix);
 
 	private:
-		std::string ReadFile(const std::string& filepath);
-		std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
-		void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
+		void Compile(const ShaderStageSources& shaderSources);
+		uint32_t GetRendererID() const;
 	private:
-		uint32_t m_RendererID;
+		ShaderHandle m_Handle;
 		std::string m_Name;
 	};
 }
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include "rmpch.h"
 
 #include "OpenGLTexture.h"
+#include "OpenGLResources.h"
+
+#include "RoMan/Asset/CookedFormats.h"
+#include "RoMan/Asset/VirtualFileSystem.h"
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
 
 #include "stb_image.h"
 
@@ -8,51 +14,99 @@
 
 namespace RoMan
 {
+	// Decompressed cooked texture strips wait here for upload. Textures are created on the render
+	// thread only, so one buffer serves all of them and stays allocated between loads.
+	static constexpr size_t StagingBudget = 8 * 1024 * 1024;
+	static std::vector<uint8_t> s_StagingBuffer;
+
 	OpenGLTexture2D::OpenGLTexture2D(const std::string& path)
 		:m_Path(path)
 	{
-		int width, height, channels;
-		stbi_set_flip_vertically_on_load(1);
-		stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
-		RM_CORE_ASSERT(data, "Failed to load texture image!");
-		
-		m_Width = width;
-		m_Height = height;
-
-		GLenum internalFormat = 0, dataFormat = 0;
-		if (channels == 4)
+		// Mapped, so a cooked texture's strips are only paged in as they are streamed
+		FileData file = VirtualFileSystem::MapFile(path);
+		RM_CORE_ASSERT(file, "Couldn't open texture file!");
+
+		uint32_t rendererID;
+		if (IsCookedTexture(file.Data, file.Size))
 		{
-			internalFormat = GL_RGBA8;
-			dataFormat = GL_RGBA;
+			// RoManCook output, already RGBA8 with its mip chain
+			CookedTexture cooked;
+			bool valid = ReadCookedTexture(file.Data, file.Size, cooked);
+			RM_CORE_ASSERT(valid, "Invalid cooked texture!");
+
+			m_Width = cooked.Header->Width;
+			m_Height = cooked.Header->Height;
+			uint32_t mipCount = cooked.Header->MipCount;
+
+			glCreateTextures(GL_TEXTURE_2D, 1, &rendererID);
+			glTextureStorage2D(rendererID, mipCount, GL_RGBA8, m_Width, m_Height);
+
+			glTextureParameteri(rendererID, GL_TEXTURE_MIN_FILTER, mipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+			glTextureParameteri(rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+			// Strip by strip through the shared staging buffer, never the whole image at once
+			bool streamed = StreamCookedTexture(cooked, s_StagingBuffer, StagingBudget, [&](uint32_t level, uint32_t y, uint32_t rows, const uint8_t* pixels)
+			{
+				glTextureSubImage2D(rendererID, level, 0, y, cooked.Mips[level].Width, rows, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+			});
+			RM_CORE_ASSERT(streamed, "Failed to stream cooked texture!");
+
+			m_Size = 0;
+			for (uint32_t level = 0; level < mipCount; level++)
+				m_Size += cooked.Mips[level].Size;
 		}
-		else if (channels == 3)
+		else
 		{
-			internalFormat = GL_RGB8;
-			dataFormat = GL_RGB;
-		}
+			int width, height, channels;
+			stbi_set_flip_vertically_on_load(1);
+			stbi_uc* data = stbi_load_from_memory(file.Data, (int)file.Size, &width, &height, &channels, 0);
+			RM_CORE_ASSERT(data, "Failed to load texture image!");
+
+			m_Width = width;
+			m_Height = height;
 
-		RM_CORE_ASSERT(internalFormat & dataFormat, "Format Not Supported!");
+			GLenum internalFormat = 0, dataFormat = 0;
+			if (channels == 4)
+			{
+				internalFormat = GL_RGBA8;
+				dataFormat = GL_RGBA;
+			}
+			else if (channels == 3)
+			{
+				internalFormat = GL_RGB8;
+				dataFormat = GL_RGB;
+			}
 
+			RM_CORE_ASSERT(internalFormat & dataFormat, "Format Not Supported!");
 
+			glCreateTextures(GL_TEXTURE_2D, 1, &rendererID);
+			glTextureStorage2D(rendererID, 1, internalFormat, m_Width, m_Height);
 
-		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-		glTextureStorage2D(m_RendererID, 1, internalFormat, m_Width, m_Height);
+			glTextureParameteri(rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTextureSubImage2D(rendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, data);
 
-		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, data);
+			stbi_image_free(data);
 
-		stbi_image_free(data);
+			m_Size = (uint64_t)m_Width * m_Height * channels;
+		}
+
+		m_Handle = OpenGLResources::GetTextures().Create({ rendererID, m_Width, m_Height });
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::Texture, this, m_Size);
 	}
 
 	OpenGLTexture2D::~OpenGLTexture2D()
 	{
-		glDeleteTextures(1, &m_RendererID);
+		glDeleteTextures(1, &OpenGLResources::GetTextures().Get(m_Handle).RendererID);
+		OpenGLResources::GetTextures().Destroy(m_Handle);
+
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::Texture, this);
 	}
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
 	{
-		glBindTextureUnit(slot, m_RendererID);
+		glBindTextureUnit(slot, OpenGLResources::GetTextures().Get(m_Handle).RendererID);
+		FrameStats::RecordStateChange();
 	}
 }
\ No newline at end of file
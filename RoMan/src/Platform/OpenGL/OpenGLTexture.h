@@ -12,13 +12,17 @@ namespace RoMan
 
 		virtual uint32_t GetWidth() const override { return m_Width; }
 		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint64_t GetMemorySize() const override { return m_Size; }
 
 		virtual void Bind(uint32_t slot = 0) const override;
 
+		virtual TextureHandle GetHandle() const override { return m_Handle; }
+
 	private:
 		std::string m_Path;
 		uint32_t m_Width;
 		uint32_t m_Height;
-		uint32_t m_RendererID;
+		uint64_t m_Size;
+		TextureHandle m_Handle;
 	};
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "rmpch.h"
 #include "OpenGLVertexArray.h"
+#include "OpenGLResources.h"
+
+#include "RoMan/Core/FrameStats.h"
 
 #include <glad/glad.h>
 
@@ -28,25 +31,29 @@ namespace RoMan
 
 	OpenGLVertexArray::OpenGLVertexArray()
 	{
-		glCreateVertexArrays(1, &m_RendererID);
+		OpenGLVertexArrayData data;
+		glCreateVertexArrays(1, &data.RendererID);
+		m_Handle = OpenGLResources::GetVertexArrays().Create(data);
 	}
 	OpenGLVertexArray::~OpenGLVertexArray()
 	{
-		glDeleteVertexArrays(1, &m_RendererID);
+		glDeleteVertexArrays(1, &OpenGLResources::GetVertexArrays().Get(m_Handle).RendererID);
+		OpenGLResources::GetVertexArrays().Destroy(m_Handle);
 	}
 	void OpenGLVertexArray::Bind() const
 	{
-		glBindVertexArray(m_RendererID);
+		glBindVertexArray(OpenGLResources::GetVertexArrays().Get(m_Handle).RendererID);
+		FrameStats::RecordStateChange();
 	}
 	void OpenGLVertexArray::UnBind() const
 	{
 		glBindVertexArray(0);
 	}
-	void OpenGLVertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer)
+	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
 	{
 		RM_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "VertexBuffer has no layout!");
 
-		glBindVertexArray(m_RendererID);
+		glBindVertexArray(OpenGLResources::GetVertexArrays().Get(m_Handle).RendererID);
 		vertexBuffer->Bind();
 
 		const auto& layout = vertexBuffer->GetLayout();
@@ -65,11 +72,13 @@ namespace RoMan
 		m_VertexBuffers.push_back(vertexBuffer);
 
 	}
-	void OpenGLVertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer)
+	void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
 	{
-		glBindVertexArray(m_RendererID);
+		OpenGLVertexArrayData& data = OpenGLResources::GetVertexArrays().Get(m_Handle);
+		glBindVertexArray(data.RendererID);
 		indexBuffer->Bind();
 
+		data.IndexBuffer = indexBuffer->GetHandle();
 		m_IndexBuffer = indexBuffer;
 	}
 }
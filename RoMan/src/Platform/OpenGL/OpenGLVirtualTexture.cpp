@@ -0,0 +1,68 @@
+#include "rmpch.h"
+#include "OpenGLVirtualTexture.h"
+#include "OpenGLResources.h"
+
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+#include <glad/glad.h>
+
+namespace RoMan
+{
+	OpenGLVirtualTexture2D::OpenGLVirtualTexture2D(const std::string& path, const VirtualTextureSpecification& specification)
+		:VirtualTexture2D(path, specification)
+	{
+		// Pages carry their own borders, so plain bilinear filtering without mips
+		uint32_t atlasSize = GetAtlasSize();
+		uint32_t atlasID;
+		glCreateTextures(GL_TEXTURE_2D, 1, &atlasID);
+		glTextureStorage2D(atlasID, 1, GL_RGBA8, atlasSize, atlasSize);
+		glTextureParameteri(atlasID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(atlasID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(atlasID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(atlasID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		m_AtlasHandle = OpenGLResources::GetTextures().Create({ atlasID, atlasSize, atlasSize });
+
+		// One texel per page, one mip level per virtual level, read with texelFetch
+		uint32_t pagesPerSide = GetPagesPerSide();
+		uint32_t pageTableID;
+		glCreateTextures(GL_TEXTURE_2D, 1, &pageTableID);
+		glTextureStorage2D(pageTableID, GetLevelCount(), GL_RGBA8, pagesPerSide, pagesPerSide);
+		glTextureParameteri(pageTableID, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+		glTextureParameteri(pageTableID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		m_PageTableHandle = OpenGLResources::GetTextures().Create({ pageTableID, pagesPerSide, pagesPerSide });
+
+		MemoryTracker::TrackGPUAllocation(GPUMemoryType::Texture, this, GetMemorySize());
+	}
+
+	OpenGLVirtualTexture2D::~OpenGLVirtualTexture2D()
+	{
+		glDeleteTextures(1, &OpenGLResources::GetTextures().Get(m_AtlasHandle).RendererID);
+		glDeleteTextures(1, &OpenGLResources::GetTextures().Get(m_PageTableHandle).RendererID);
+		OpenGLResources::GetTextures().Destroy(m_AtlasHandle);
+		OpenGLResources::GetTextures().Destroy(m_PageTableHandle);
+
+		MemoryTracker::UntrackGPUAllocation(GPUMemoryType::Texture, this);
+	}
+
+	void OpenGLVirtualTexture2D::Bind(uint32_t slot) const
+	{
+		glBindTextureUnit(slot, OpenGLResources::GetTextures().Get(m_AtlasHandle).RendererID);
+		glBindTextureUnit(slot + 1, OpenGLResources::GetTextures().Get(m_PageTableHandle).RendererID);
+		FrameStats::RecordStateChange();
+	}
+
+	void OpenGLVirtualTexture2D::UploadPage(uint32_t slotX, uint32_t slotY, const uint8_t* pixels)
+	{
+		uint32_t slotSize = GetSlotSize();
+		glTextureSubImage2D(OpenGLResources::GetTextures().Get(m_AtlasHandle).RendererID, 0, slotX * slotSize, slotY * slotSize,
+			slotSize, slotSize, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	}
+
+	void OpenGLVirtualTexture2D::UploadPageTable(uint32_t level, const uint32_t* entries)
+	{
+		uint32_t pagesPerSide = GetPagesPerSide() >> level;
+		glTextureSubImage2D(OpenGLResources::GetTextures().Get(m_PageTableHandle).RendererID, level, 0, 0,
+			pagesPerSide, pagesPerSide, GL_RGBA, GL_UNSIGNED_BYTE, entries);
+	}
+}
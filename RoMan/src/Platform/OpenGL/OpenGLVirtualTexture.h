@@ -0,0 +1,26 @@
+#pragma once
+
+#include "RoMan/Renderer/VirtualTexture.h"
+
+namespace RoMan
+{
+	class OpenGLVirtualTexture2D : public VirtualTexture2D
+	{
+	public:
+		OpenGLVirtualTexture2D(const std::string& path, const VirtualTextureSpecification& specification);
+		virtual ~OpenGLVirtualTexture2D();
+
+		virtual void Bind(uint32_t slot = 0) const override;
+
+		// The cache atlas, the page table is only reachable through Bind
+		virtual TextureHandle GetHandle() const override { return m_AtlasHandle; }
+
+	protected:
+		virtual void UploadPage(uint32_t slotX, uint32_t slotY, const uint8_t* pixels) override;
+		virtual void UploadPageTable(uint32_t level, const uint32_t* entries) override;
+
+	private:
+		TextureHandle m_AtlasHandle;
+		TextureHandle m_PageTableHandle;
+	};
+}
@@ -0,0 +1,51 @@
+#include "rmpch.h"
+#include "RoMan/Core/MappedFile.h"
+
+namespace RoMan
+{
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		// The view keeps the mapping and the file alive
+		CloseHandle(file);
+		if (!mapping)
+		{
+			RM_CORE_ERROR("Couldn't map file {0}", filepath);
+			return false;
+		}
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (!data)
+		{
+			RM_CORE_ERROR("Couldn't map file {0}", filepath);
+			return false;
+		}
+
+		m_Data = (const uint8_t*)data;
+		m_Size = (uint64_t)size.QuadPart;
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+}
@@ -1,50 +1,15 @@
 #pragma once
 
-#include "RoMan/Window.h"
-#include "RoMan/Renderer/GraphicsContext.h"
-
-#include <GLFW/glfw3.h>
+#include "Platform/GLFW/GLFWWindow.h"
 
 namespace RoMan
 {
-	class WindowsWindow : public Window
+	class WindowsWindow : public GLFWWindow
 	{
 	public:
 		WindowsWindow(const WindowProps& props);
-		virtual ~WindowsWindow();
-
-		void OnUpdate() override;
-
-		inline unsigned int GetWidth() const override { return m_Data.Width; }
-		inline unsigned int GetHeight() const override { return m_Data.Height; }
-
-		// Window attributes
-		inline void SetEventCallback(const EventCallbackFn& callback) override { m_Data.EventCallback = callback; }
-		void SetVSync(bool enabled) override;
-		bool IsVSync() const override;
-
-		inline virtual void* GetNativeWindow() const { return m_Window; }
-
-	private:
-		virtual void Init(const WindowProps& props);
-		virtual void Shutdown();
 
-	private:
-		GLFWwindow* m_Window;
-		GraphicsContext* m_Context;
-
-		struct WindowData
-		{
-			std::string Title;
-			unsigned int Width, Height;
-			bool VSync;
-
-			EventCallbackFn EventCallback;
-		};
-
-		WindowData m_Data;
+	protected:
+		virtual const char* GetSwapControlTearExtension() const override { return "WGL_EXT_swap_control_tear"; }
 	};
 }
-
-
-
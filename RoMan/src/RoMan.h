@@ -7,12 +7,26 @@
 #include "RoMan/Log.h"
 
 #include "RoMan/Core/Timestep.h"
+#include "RoMan/Core/Timer.h"
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Core/MemoryTracker.h"
+#include "RoMan/Core/ThreadPool.h"
+#include "RoMan/Core/BinaryLog.h"
+
+#include "RoMan/Asset/VirtualFileSystem.h"
+#include "RoMan/Asset/AssetManager.h"
+
+#include "RoMan/Math/BatchTransform.h"
+#include "RoMan/Math/AABB.h"
+#include "RoMan/Math/Frustum.h"
 
 #include "RoMan/Input.h"
 #include "RoMan/KeyCodes.h"
 #include "RoMan/MouseButtonCodes.h"
 
 #include "RoMan/ImGui/ImGuiLayer.h"
+#include "RoMan/ImGui/ImGuiPanels.h"
 
 //-----------Renderer-------------------------
 
@@ -20,14 +34,30 @@
 #include "RoMan/Renderer/RenderCommand.h"
 
 #include "RoMan/Renderer/Buffer.h"
+#include "RoMan/Renderer/Framebuffer.h"
+#include "RoMan/Renderer/GPUTimer.h"
+#include "RoMan/Renderer/PostProcessStack.h"
+#include "RoMan/Renderer/RenderGraph.h"
 #include "RoMan/Renderer/Shader.h"
 #include "RoMan/Renderer/VertexArray.h"
 
 #include "RoMan/Renderer/Texture.h"
+#include "RoMan/Renderer/VirtualTexture.h"
 
 //------------Camera---------------------------
 
+#include "RoMan/Renderer/Camera.h"
 #include "RoMan/Renderer/OrthographicCamera.h"
+#include "RoMan/Renderer/PerspectiveCamera.h"
+#include "RoMan/Renderer/CameraController.h"
+
+//------------Scene----------------------------
+
+#include "RoMan/Scene/Scene.h"
+#include "RoMan/Scene/Entity.h"
+#include "RoMan/Scene/Components.h"
+#include "RoMan/Scene/TransformHierarchy.h"
+#include "RoMan/Scene/SpatialGrid.h"
 
 //-------Entry Point------------
 #include "RoMan/EntryPoint.h"
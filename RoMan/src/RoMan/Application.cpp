@@ -7,7 +7,14 @@
 
 #include "RoMan/Renderer/Renderer.h"
 
-#include "GLFW/glfw3.h" //TODO: will be removed in the future when timing calculation is implemented in Platform
+#include "RoMan/Asset/AssetManager.h"
+#include "RoMan/Asset/VirtualFileSystem.h"
+
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Core/MemoryTracker.h"
+#include "RoMan/Core/ThreadPool.h"
+#include "RoMan/Core/Timer.h"
 
 namespace RoMan
 {
@@ -20,51 +27,124 @@ namespace RoMan
 		RM_CORE_ASSERT(!s_Instance, "Application already exists!");
 		s_Instance = this;
 
+		RM_MEMORY_SCOPE(MemoryTag::Core);
+
+		FrameAllocator::Init(4 * 1024 * 1024);
+		ThreadPool::Init();
+		VirtualFileSystem::Init();
+
 		m_Window = std::unique_ptr<Window>(Window::Create());
 		m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
 		m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
 
 		Renderer::Init();
+		Renderer::OnWindowResize(m_Window->GetWidth(), m_Window->GetHeight());
+		AssetManager::Init();
 
-		m_ImGuiLayer = new ImGuiLayer();
-		PushOverlay(m_ImGuiLayer);
+		// ImGui renders through OpenGL into a GLFW window, so there is nothing to draw it with in headless mode
+		if (Renderer::GetAPI() != RendererAPI::API::Null && m_Window->GetNativeWindow())
+		{
+			m_ImGuiLayer = new ImGuiLayer();
+			PushOverlay(m_ImGuiLayer);
+		}
+	}
 
+	Application::~Application()
+	{
+		AssetManager::Shutdown();
+		VirtualFileSystem::Shutdown();
+		ThreadPool::Shutdown();
+		FrameAllocator::Shutdown();
 	}
 
 	void Application::PushLayer(Layer* layer)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Layer);
 		m_LayerStack.PushLayer(layer);
 	}
 
 	void Application::PushOverlay(Layer* layer)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Layer);
 		m_LayerStack.PushOverlay(layer);
 	}
 
+	void Application::SetFixedTimestep(float seconds, uint32_t maxStepsPerFrame)
+	{
+		m_FixedTimestep = (uint64_t)(seconds * 1e9);
+		m_FixedAccumulator = 0;
+		m_MaxFixedStepsPerFrame = maxStepsPerFrame;
+	}
+
 	void Application::Run()
 	{
+		m_LastFrameTime = Timer::Now();
+
 		while (m_Running)
 		{
-			float time = (float) glfwGetTime();
-			Timestep ts = time - m_LastFrameTime;
+			uint64_t time = Timer::Now();
+			uint64_t frameTime = time - m_LastFrameTime;
 			m_LastFrameTime = time;
 
+			FrameAllocator::NextFrame();
+
+			Timestep ts = (float)(frameTime * 1e-9);
+
+			FrameStats::BeginFrame(ts);
+
+			Timer updateTimer;
+			RM_MEMORY_SCOPE(MemoryTag::Layer);
+			if (m_FixedTimestep)
+			{
+				m_FixedAccumulator += frameTime;
+
+				Timestep fixedTs((float)(m_FixedTimestep * 1e-9));
+				uint32_t steps = 0;
+				while (m_FixedAccumulator >= m_FixedTimestep && steps < m_MaxFixedStepsPerFrame)
+				{
+					for (Layer* layer : m_LayerStack)
+						layer->OnFixedUpdate(fixedTs);
+
+					m_FixedAccumulator -= m_FixedTimestep;
+					steps++;
+				}
+
+				// Drop the time we couldn't catch up on, otherwise slow frames feed on themselves
+				if (m_FixedAccumulator >= m_FixedTimestep)
+					m_FixedAccumulator %= m_FixedTimestep;
+
+				ts = Timestep(ts.GetSeconds(), (float)m_FixedAccumulator / (float)m_FixedTimestep);
+			}
+
 			for (Layer* layer : m_LayerStack)
 				layer->OnUpdate(ts);
+			FrameStats::SetUpdateTime(updateTimer.ElapsedMillis());
 
-			m_ImGuiLayer->Begin();
-			for (Layer* layer : m_LayerStack)
-				layer->OnImGuiRender();
-			m_ImGuiLayer->End();
+			if (m_ImGuiLayer)
+			{
+				m_ImGuiLayer->Begin();
+				for (Layer* layer : m_LayerStack)
+					layer->OnImGuiRender();
+				m_ImGuiLayer->End();
+			}
 
 			m_Window->OnUpdate();
+
+			FrameStats::SetWaitTime(m_FramePacer.Wait() * 1e-6f);
+			FrameStats::EndFrame();
+
+			if (m_FrameLimit && FrameStats::GetFrameCount() >= m_FrameLimit)
+				m_Running = false;
 		}
 	}
 
 	void Application::OnEvent(Event& e)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Event);
+
 		EventDispatcher dispatcher(e);
 		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(OnWindowClose));
+		dispatcher.Dispatch<WindowResizeEvent>(BIND_EVENT_FN(OnWindowResize));
 
 		for (auto it = m_LayerStack.end(); it != m_LayerStack.begin(); )
 		{
@@ -79,6 +159,16 @@ namespace RoMan
 		m_Running = false;
 		return true;
 	}
+
+	bool Application::OnWindowResize(WindowResizeEvent& e)
+	{
+		// Minimized, keep the last size so framebuffers sized after the window stay valid
+		if (e.GetWidth() == 0 || e.GetHeight() == 0)
+			return false;
+
+		Renderer::OnWindowResize(e.GetWidth(), e.GetHeight());
+		return false;
+	}
 }
 
 
@@ -9,6 +9,8 @@
 
 #include "RoMan/ImGui/ImGuiLayer.h"
 
+#include "RoMan/Core/FramePacer.h"
+
 #include "RoMan/Renderer/Shader.h"
 
 #include "RoMan/Renderer/Buffer.h"
@@ -23,7 +25,7 @@ namespace RoMan
 	{
 	public:
 		Application();
-		virtual ~Application() = default;
+		virtual ~Application();
 		void Run();
 
 		void OnEvent(Event& e);
@@ -32,17 +34,33 @@ namespace RoMan
 
 		inline Window& GetWindow() { return *m_Window; }
 
+		// Stops the main loop after the given number of frames, 0 runs until the window is closed
+		inline void SetFrameLimit(uint32_t frameCount) { m_FrameLimit = frameCount; }
+
+		// Runs Layer::OnFixedUpdate at a fixed rate, at most maxStepsPerFrame times per frame. 0 disables it.
+		void SetFixedTimestep(float seconds, uint32_t maxStepsPerFrame = 5);
+
+		// Caps the frame rate without busy-waiting the whole frame, 0 runs uncapped
+		inline void SetTargetFPS(float fps) { m_FramePacer.SetTargetFPS(fps); }
+
 		inline static Application& Get() { return *s_Instance; }
 
 	private:
 		bool OnWindowClose(WindowCloseEvent& e);
+		bool OnWindowResize(WindowResizeEvent& e);
 
 		std::unique_ptr<Window> m_Window;
-		ImGuiLayer* m_ImGuiLayer;
+		ImGuiLayer* m_ImGuiLayer = nullptr;
 		bool m_Running = true;
 		LayerStack m_LayerStack;
 
-		float m_LastFrameTime = 0.0f;
+		uint64_t m_LastFrameTime = 0;
+		uint32_t m_FrameLimit = 0;
+		FramePacer m_FramePacer;
+
+		uint64_t m_FixedTimestep = 0;
+		uint64_t m_FixedAccumulator = 0;
+		uint32_t m_MaxFixedStepsPerFrame = 5;
 	private:
 		static Application* s_Instance;
 	};
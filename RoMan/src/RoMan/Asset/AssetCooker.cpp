@@ -0,0 +1,571 @@
+#include "rmpch.h"
+#include "AssetCooker.h"
+
+#include "RoMan/Asset/PackFormat.h"
+#include "RoMan/Core/Compression.h"
+#include "RoMan/Core/Hash.h"
+#include "RoMan/Core/ThreadPool.h"
+
+#include "stb_image.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace RoMan
+{
+	namespace fs = std::filesystem;
+
+	// Rows per texture strip are picked so a strip of the first level is about this big
+	static constexpr uint32_t TextureStripSize = 256 * 1024;
+
+	// Virtual texture pages, the border covers bilinear filtering with some slack
+	static constexpr uint32_t VirtualTexturePageSize = 128;
+	static constexpr uint32_t VirtualTextureBorder = 4;
+
+	static bool ReadDiskFile(const std::string& path, std::vector<uint8_t>& out)
+	{
+		std::ifstream in(path, std::ios::in | std::ios::binary);
+		if (!in)
+			return false;
+
+		in.seekg(0, std::ios::end);
+		out.resize((size_t)in.tellg());
+		in.seekg(0, std::ios::beg);
+		in.read((char*)out.data(), out.size());
+		return (bool)in;
+	}
+
+	static bool WriteDiskFile(const std::string& path, const std::vector<uint8_t>& data)
+	{
+		// Other jobs may be creating the same directories, only the result matters
+		std::error_code error;
+		fs::path parent = fs::path(path).parent_path();
+		if (!parent.empty())
+			fs::create_directories(parent, error);
+
+		std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out)
+			return false;
+
+		out.write((const char*)data.data(), data.size());
+		return (bool)out;
+	}
+
+	// 2x2 box filter, edges are clamped so 1 pixel wide levels still average their pairs
+	static void DownsampleRGBA8(const uint8_t* src, uint32_t srcWidth, uint32_t srcHeight, uint8_t* dst, uint32_t dstWidth, uint32_t dstHeight)
+	{
+		for (uint32_t y = 0; y < dstHeight; y++)
+		{
+			const uint8_t* row0 = src + (size_t)std::min(y * 2, srcHeight - 1) * srcWidth * 4;
+			const uint8_t* row1 = src + (size_t)std::min(y * 2 + 1, srcHeight - 1) * srcWidth * 4;
+			uint8_t* out = dst + (size_t)y * dstWidth * 4;
+
+			for (uint32_t x = 0; x < dstWidth; x++)
+			{
+				uint32_t x0 = std::min(x * 2, srcWidth - 1) * 4;
+				uint32_t x1 = std::min(x * 2 + 1, srcWidth - 1) * 4;
+				for (uint32_t c = 0; c < 4; c++)
+					out[x * 4 + c] = (uint8_t)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) >> 2);
+			}
+		}
+	}
+
+	AssetCooker::AssetCooker(const std::string& outputDirectory)
+		:m_OutputDirectory(outputDirectory)
+	{
+	}
+
+	bool AssetCooker::AddDirectory(const std::string& directory)
+	{
+		fs::path root = fs::path(directory).lexically_normal();
+		if (!fs::is_directory(root))
+		{
+			RM_CORE_ERROR("{0} is not a directory", root.string());
+			return false;
+		}
+
+		fs::path base = root.has_parent_path() ? root.parent_path() : fs::current_path();
+		for (const fs::directory_entry& entry : fs::recursive_directory_iterator(root))
+		{
+			if (entry.is_regular_file())
+				AddFile(fs::relative(entry.path(), base).generic_string(), entry.path().string());
+		}
+
+		return true;
+	}
+
+	void AssetCooker::AddFile(const std::string& path, const std::string& diskPath)
+	{
+		std::string normalized = NormalizePackPath(path);
+
+		auto it = m_SourceIndices.find(normalized);
+		if (it != m_SourceIndices.end())
+		{
+			RM_CORE_WARN("{0} added to the cook twice, keeping the last one", normalized);
+			m_Sources[it->second].DiskPath = diskPath;
+			return;
+		}
+
+		m_SourceIndices[normalized] = m_Sources.size();
+		m_Sources.push_back({ normalized, diskPath });
+	}
+
+	bool AssetCooker::Cook(bool force)
+	{
+		struct CookResult
+		{
+			CookType Type = CookType::Copy;
+			bool Cooked = false;
+			bool Failed = false;
+			uint64_t InputSize = 0;
+			uint64_t OutputSize = 0;
+			std::vector<Dependency> Dependencies;
+		};
+
+		m_Stats = {};
+		LoadManifest();
+
+		std::vector<CookResult> results(m_Sources.size());
+		ThreadPool::ParallelFor((uint32_t)m_Sources.size(), 1, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				const Source& source = m_Sources[i];
+				CookResult& result = results[i];
+				result.Type = GetCookType(source.Path);
+
+				std::vector<uint8_t> input;
+				if (!ReadDiskFile(source.DiskPath, input))
+				{
+					RM_CORE_ERROR("Couldn't open file path {0}", source.DiskPath);
+					result.Failed = true;
+					continue;
+				}
+
+				result.InputSize = input.size();
+				result.Dependencies.push_back({ source.Path, HashFNV1a(input.data(), input.size()) });
+
+				std::string outputPath = GetOutputPath(source.Path);
+				auto it = m_Manifest.find(source.Path);
+				if (!force && it != m_Manifest.end())
+				{
+					const ManifestEntry& entry = it->second;
+
+					bool upToDate = entry.Type == result.Type && entry.CookerVersion == Version &&
+						entry.Dependencies.size() == result.Dependencies.size();
+					for (size_t d = 0; upToDate && d < entry.Dependencies.size(); d++)
+					{
+						upToDate = entry.Dependencies[d].Path == result.Dependencies[d].Path &&
+							entry.Dependencies[d].Hash == result.Dependencies[d].Hash;
+					}
+
+					std::error_code error;
+					if (upToDate && fs::file_size(outputPath, error) == entry.OutputSize && !error)
+					{
+						result.OutputSize = entry.OutputSize;
+						continue;
+					}
+				}
+
+				std::vector<uint8_t> output;
+				bool cooked = true;
+				switch (result.Type)
+				{
+				case CookType::Shader:         cooked = CookShader(input.data(), input.size(), output); break;
+				case CookType::Texture:        cooked = CookTexture(input.data(), input.size(), output); break;
+				case CookType::VirtualTexture: cooked = CookVirtualTexture(input.data(), input.size(), output); break;
+				case CookType::Copy:           output = std::move(input); break;
+				}
+
+				if (!cooked)
+				{
+					RM_CORE_ERROR("Failed to cook {0}", source.Path);
+					result.Failed = true;
+					continue;
+				}
+
+				if (!WriteDiskFile(outputPath, output))
+				{
+					RM_CORE_ERROR("Couldn't write {0}", outputPath);
+					result.Failed = true;
+					continue;
+				}
+
+				RM_CORE_TRACE("Cooked {0} ({1}): {2} bytes -> {3} bytes", source.Path, GetCookTypeName(result.Type),
+					result.InputSize, output.size());
+				result.Cooked = true;
+				result.OutputSize = output.size();
+			}
+		});
+
+		// Failed sources are left out of the manifest so the next run retries them
+		std::unordered_map<std::string, ManifestEntry> manifest;
+		for (size_t i = 0; i < m_Sources.size(); i++)
+		{
+			CookResult& result = results[i];
+			if (result.Failed)
+			{
+				m_Stats.Failed++;
+				continue;
+			}
+
+			if (result.Cooked)
+				m_Stats.Cooked++;
+			else
+				m_Stats.UpToDate++;
+			m_Stats.InputBytes += result.InputSize;
+			m_Stats.OutputBytes += result.OutputSize;
+
+			ManifestEntry& entry = manifest[m_Sources[i].Path];
+			entry.Type = result.Type;
+			entry.CookerVersion = Version;
+			entry.OutputSize = result.OutputSize;
+			entry.Dependencies = std::move(result.Dependencies);
+		}
+
+		for (const auto& [path, entry] : m_Manifest)
+		{
+			if (m_SourceIndices.find(path) != m_SourceIndices.end())
+				continue;
+
+			// An output that is already gone isn't counted, one that can't be deleted is reported
+			std::error_code error;
+			if (fs::remove(GetOutputPath(path), error))
+			{
+				RM_CORE_TRACE("Removed {0}, its source is gone", path);
+				m_Stats.Removed++;
+			}
+			else if (error)
+				RM_CORE_WARN("Couldn't remove {0}: {1}", GetOutputPath(path), error.message());
+		}
+
+		m_Manifest = std::move(manifest);
+		if (!SaveManifest())
+			return false;
+
+		return m_Stats.Failed == 0;
+	}
+
+	CookType AssetCooker::GetCookType(const std::string& path)
+	{
+		std::string extension = fs::path(path).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+
+		if (extension == ".glsl")
+			return CookType::Shader;
+		if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp")
+			return fs::path(path).stem().extension() == ".virtual" ? CookType::VirtualTexture : CookType::Texture;
+
+		return CookType::Copy;
+	}
+
+	const char* AssetCooker::GetCookTypeName(CookType type)
+	{
+		switch (type)
+		{
+		case CookType::Copy:           return "Copy";
+		case CookType::Shader:         return "Shader";
+		case CookType::Texture:        return "Texture";
+		case CookType::VirtualTexture: return "VirtualTexture";
+		}
+
+		return "Unknown";
+	}
+
+	bool AssetCooker::CookShader(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+	{
+		ShaderStageSources stages;
+		if (!SplitShaderSource(std::string_view((const char*)data, size), stages))
+			return false;
+
+		CookedShaderHeader header;
+		header.StageCount = (uint32_t)stages.size();
+
+		out.clear();
+		out.insert(out.end(), (const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+		for (const auto& [stage, stageSource] : stages)
+		{
+			CookedShaderStage stageHeader;
+			stageHeader.Stage = (uint32_t)stage;
+			stageHeader.Size = (uint32_t)stageSource.size();
+			out.insert(out.end(), (const uint8_t*)&stageHeader, (const uint8_t*)&stageHeader + sizeof(stageHeader));
+			out.insert(out.end(), stageSource.begin(), stageSource.end());
+		}
+
+		return true;
+	}
+
+	bool AssetCooker::CookTexture(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+	{
+		// Jobs decode on several threads at once, the global flip flag would race with the runtime loaders
+		int width, height, channels;
+		stbi_set_flip_vertically_on_load_thread(1);
+		stbi_uc* pixels = stbi_load_from_memory(data, (int)size, &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			RM_CORE_ERROR("Failed to decode image: {0}", stbi_failure_reason());
+			return false;
+		}
+
+		CookedTextureHeader header;
+		header.Width = (uint32_t)width;
+		header.Height = (uint32_t)height;
+		header.Format = (uint32_t)CookedTextureFormat::RGBA8;
+		header.MipCount = 1;
+		while ((std::max(header.Width, header.Height) >> header.MipCount) > 0)
+			header.MipCount++;
+		header.StripHeight = std::clamp(TextureStripSize / (header.Width * 4), 1u, header.Height);
+
+		// Build the whole chain first, every level is filtered from the one above
+		std::vector<CookedTextureMip> mips(header.MipCount);
+		std::vector<std::vector<uint8_t>> levels(header.MipCount);
+		uint32_t stripCount = 0;
+		for (uint32_t i = 0; i < header.MipCount; i++)
+		{
+			CookedTextureMip& mip = mips[i];
+			mip.Width = std::max(header.Width >> i, 1u);
+			mip.Height = std::max(header.Height >> i, 1u);
+			mip.FirstStrip = stripCount;
+			mip.StripCount = (mip.Height + header.StripHeight - 1) / header.StripHeight;
+			mip.Size = (uint64_t)mip.Width * mip.Height * 4;
+			stripCount += mip.StripCount;
+
+			levels[i].resize((size_t)mip.Size);
+			if (i == 0)
+				memcpy(levels[i].data(), pixels, (size_t)mip.Size);
+			else
+				DownsampleRGBA8(levels[i - 1].data(), mips[i - 1].Width, mips[i - 1].Height, levels[i].data(), mip.Width, mip.Height);
+		}
+		stbi_image_free(pixels);
+
+		std::vector<CookedTextureStrip> strips(stripCount);
+		std::vector<uint8_t> stripData;
+		std::vector<uint8_t> compressed;
+		uint64_t dataOffset = sizeof(CookedTextureHeader) + sizeof(CookedTextureMip) * mips.size() + sizeof(CookedTextureStrip) * strips.size();
+		for (uint32_t level = 0; level < header.MipCount; level++)
+		{
+			const CookedTextureMip& mip = mips[level];
+			size_t rowSize = (size_t)mip.Width * 4;
+			for (uint32_t i = 0; i < mip.StripCount; i++)
+			{
+				uint32_t rows = std::min(header.StripHeight, mip.Height - i * header.StripHeight);
+				const uint8_t* src = levels[level].data() + (size_t)i * header.StripHeight * rowSize;
+				size_t size = rows * rowSize;
+
+				// Raw strips upload straight from the file, only compress when it saves at least 1/8
+				CookedTextureStrip& strip = strips[mip.FirstStrip + i];
+				stripData.resize((stripData.size() + 15) & ~(size_t)15);
+				strip.Offset = dataOffset + stripData.size();
+				if (Compression::Compress(CompressionType::LZ4, src, size, compressed) && compressed.size() <= size - size / 8)
+				{
+					strip.Compression = (uint32_t)CompressionType::LZ4;
+					strip.StoredSize = (uint32_t)compressed.size();
+					stripData.insert(stripData.end(), compressed.begin(), compressed.end());
+				}
+				else
+				{
+					strip.Compression = (uint32_t)CompressionType::None;
+					strip.StoredSize = (uint32_t)size;
+					stripData.insert(stripData.end(), src, src + size);
+				}
+			}
+		}
+
+		out.clear();
+		out.reserve((size_t)dataOffset + stripData.size());
+		out.insert(out.end(), (const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+		out.insert(out.end(), (const uint8_t*)mips.data(), (const uint8_t*)(mips.data() + mips.size()));
+		out.insert(out.end(), (const uint8_t*)strips.data(), (const uint8_t*)(strips.data() + strips.size()));
+		out.insert(out.end(), stripData.begin(), stripData.end());
+		return true;
+	}
+
+	bool AssetCooker::CookVirtualTexture(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+	{
+		int width, height, channels;
+		stbi_set_flip_vertically_on_load_thread(1);
+		stbi_uc* pixels = stbi_load_from_memory(data, (int)size, &width, &height, &channels, 4);
+		if (!pixels)
+		{
+			RM_CORE_ERROR("Failed to decode image: {0}", stbi_failure_reason());
+			return false;
+		}
+
+		CookedVirtualTextureHeader header;
+		header.Width = (uint32_t)width;
+		header.Height = (uint32_t)height;
+		header.PageSize = VirtualTexturePageSize;
+		header.Border = VirtualTextureBorder;
+
+		uint32_t pagesPerSide = 1;
+		while (pagesPerSide * header.PageSize < std::max(header.Width, header.Height))
+			pagesPerSide *= 2;
+		header.MipCount = 1;
+		while ((pagesPerSide >> (header.MipCount - 1)) > 1)
+			header.MipCount++;
+
+		// The padding repeats the last row and column so filtering at the image edge stays clean
+		uint32_t levelSize = pagesPerSide * header.PageSize;
+		std::vector<uint8_t> level((size_t)levelSize * levelSize * 4);
+		for (uint32_t y = 0; y < levelSize; y++)
+		{
+			const uint8_t* src = pixels + (size_t)std::min(y, header.Height - 1) * header.Width * 4;
+			uint8_t* dst = level.data() + (size_t)y * levelSize * 4;
+			memcpy(dst, src, (size_t)header.Width * 4);
+			for (uint32_t x = header.Width; x < levelSize; x++)
+				memcpy(dst + x * 4, src + (header.Width - 1) * 4, 4);
+		}
+		stbi_image_free(pixels);
+
+		std::vector<CookedVirtualTextureMip> mips(header.MipCount);
+		for (uint32_t i = 0; i < header.MipCount; i++)
+		{
+			mips[i].PagesPerSide = pagesPerSide >> i;
+			mips[i].FirstPage = header.PageCount;
+			header.PageCount += mips[i].PagesPerSide * mips[i].PagesPerSide;
+		}
+
+		uint32_t slotSize = header.PageSize + header.Border * 2;
+		std::vector<CookedVirtualTexturePage> pages(header.PageCount);
+		std::vector<uint8_t> pageData;
+		std::vector<uint8_t> page((size_t)slotSize * slotSize * 4);
+		std::vector<uint8_t> compressed;
+		uint64_t dataOffset = sizeof(CookedVirtualTextureHeader) + sizeof(CookedVirtualTextureMip) * mips.size() + sizeof(CookedVirtualTexturePage) * pages.size();
+		for (uint32_t i = 0; i < header.MipCount; i++)
+		{
+			if (i > 0)
+			{
+				std::vector<uint8_t> next((size_t)(levelSize / 2) * (levelSize / 2) * 4);
+				DownsampleRGBA8(level.data(), levelSize, levelSize, next.data(), levelSize / 2, levelSize / 2);
+				level = std::move(next);
+				levelSize /= 2;
+			}
+
+			for (uint32_t pageY = 0; pageY < mips[i].PagesPerSide; pageY++)
+			{
+				for (uint32_t pageX = 0; pageX < mips[i].PagesPerSide; pageX++)
+				{
+					int32_t originX = (int32_t)(pageX * header.PageSize) - (int32_t)header.Border;
+					int32_t originY = (int32_t)(pageY * header.PageSize) - (int32_t)header.Border;
+					for (uint32_t y = 0; y < slotSize; y++)
+					{
+						uint32_t srcY = (uint32_t)std::clamp(originY + (int32_t)y, 0, (int32_t)levelSize - 1);
+						for (uint32_t x = 0; x < slotSize; x++)
+						{
+							uint32_t srcX = (uint32_t)std::clamp(originX + (int32_t)x, 0, (int32_t)levelSize - 1);
+							memcpy(&page[((size_t)y * slotSize + x) * 4], &level[((size_t)srcY * levelSize + srcX) * 4], 4);
+						}
+					}
+
+					CookedVirtualTexturePage& entry = pages[mips[i].FirstPage + pageY * mips[i].PagesPerSide + pageX];
+					pageData.resize((pageData.size() + 15) & ~(size_t)15);
+					entry.Offset = dataOffset + pageData.size();
+					if (Compression::Compress(CompressionType::LZ4, page.data(), page.size(), compressed) && compressed.size() <= page.size() - page.size() / 8)
+					{
+						entry.Compression = (uint32_t)CompressionType::LZ4;
+						entry.StoredSize = (uint32_t)compressed.size();
+						pageData.insert(pageData.end(), compressed.begin(), compressed.end());
+					}
+					else
+					{
+						entry.Compression = (uint32_t)CompressionType::None;
+						entry.StoredSize = (uint32_t)page.size();
+						pageData.insert(pageData.end(), page.begin(), page.end());
+					}
+				}
+			}
+		}
+
+		out.clear();
+		out.reserve((size_t)dataOffset + pageData.size());
+		out.insert(out.end(), (const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+		out.insert(out.end(), (const uint8_t*)mips.data(), (const uint8_t*)(mips.data() + mips.size()));
+		out.insert(out.end(), (const uint8_t*)pages.data(), (const uint8_t*)(pages.data() + pages.size()));
+		out.insert(out.end(), pageData.begin(), pageData.end());
+		return true;
+	}
+
+	void AssetCooker::LoadManifest()
+	{
+		m_Manifest.clear();
+
+		std::ifstream in(GetManifestPath());
+		if (!in)
+			return;
+
+		std::string line;
+		if (!std::getline(in, line) || line != "RoManCook manifest 1")
+		{
+			RM_CORE_WARN("{0} has an unknown format, cooking everything", GetManifestPath());
+			return;
+		}
+
+		// path, type, cooker version, output size, then pairs of dependency path and content hash
+		while (std::getline(in, line))
+		{
+			std::vector<std::string> fields;
+			size_t begin = 0;
+			while (begin <= line.size())
+			{
+				size_t tab = line.find('\t', begin);
+				if (tab == std::string::npos)
+					tab = line.size();
+				fields.push_back(line.substr(begin, tab - begin));
+				begin = tab + 1;
+			}
+
+			if (fields.size() < 4 || (fields.size() - 4) % 2 != 0)
+				continue;
+
+			ManifestEntry entry;
+			entry.Type = (CookType)std::strtoul(fields[1].c_str(), nullptr, 10);
+			entry.CookerVersion = (uint32_t)std::strtoul(fields[2].c_str(), nullptr, 10);
+			entry.OutputSize = std::strtoull(fields[3].c_str(), nullptr, 10);
+			for (size_t i = 4; i < fields.size(); i += 2)
+				entry.Dependencies.push_back({ fields[i], std::strtoull(fields[i + 1].c_str(), nullptr, 16) });
+
+			m_Manifest[fields[0]] = std::move(entry);
+		}
+	}
+
+	bool AssetCooker::SaveManifest() const
+	{
+		// Sorted so the manifest diffs cleanly between runs
+		std::vector<const std::pair<const std::string, ManifestEntry>*> entries;
+		entries.reserve(m_Manifest.size());
+		for (const auto& entry : m_Manifest)
+			entries.push_back(&entry);
+		std::sort(entries.begin(), entries.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+		std::error_code error;
+		fs::create_directories(m_OutputDirectory, error);
+
+		std::ofstream out(GetManifestPath(), std::ios::out | std::ios::trunc);
+		if (!out)
+		{
+			RM_CORE_ERROR("Couldn't write {0}", GetManifestPath());
+			return false;
+		}
+
+		out << "RoManCook manifest 1\n";
+		for (const auto* entry : entries)
+		{
+			out << entry->first << '\t' << (uint32_t)entry->second.Type << '\t' << entry->second.CookerVersion << '\t' << entry->second.OutputSize;
+			for (const Dependency& dependency : entry->second.Dependencies)
+				out << '\t' << dependency.Path << '\t' << std::hex << dependency.Hash << std::dec;
+			out << '\n';
+		}
+
+		return (bool)out;
+	}
+
+	std::string AssetCooker::GetManifestPath() const
+	{
+		return (fs::path(m_OutputDirectory) / "CookManifest.txt").string();
+	}
+
+	std::string AssetCooker::GetOutputPath(const std::string& path) const
+	{
+		return (fs::path(m_OutputDirectory) / path).string();
+	}
+}
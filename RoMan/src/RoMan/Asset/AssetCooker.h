@@ -0,0 +1,93 @@
+#pragma once
+
+#include "RoMan/Asset/CookedFormats.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RoMan
+{
+	enum class CookType
+	{
+		Copy = 0, Shader, Texture, VirtualTexture
+	};
+
+	struct CookStats
+	{
+		uint32_t Cooked = 0;
+		uint32_t UpToDate = 0;
+		uint32_t Failed = 0;
+		uint32_t Removed = 0;
+		uint64_t InputBytes = 0;
+		uint64_t OutputBytes = 0;
+	};
+
+	// Offline processing behind RoManCook. Sources are cooked into an output directory under the same
+	// relative paths, and CookManifest.txt there records each output with the content hash of every
+	// input it was built from. Inputs whose hashes, and the cooker version, didn't change since the
+	// last run are skipped. Sources are read, hashed and cooked in parallel on the ThreadPool.
+	class AssetCooker
+	{
+	public:
+		// Bump whenever cooking produces different output, forces a full recook
+		static constexpr uint32_t Version = 2;
+
+		AssetCooker(const std::string& outputDirectory);
+
+		// Adds every file under directory, with paths relative to its parent like RoManPack
+		bool AddDirectory(const std::string& directory);
+		void AddFile(const std::string& path, const std::string& diskPath);
+
+		// force recooks everything. Outputs whose source is gone are deleted, the manifest
+		// describes the whole output directory.
+		bool Cook(bool force = false);
+
+		const CookStats& GetStats() const { return m_Stats; }
+
+		static CookType GetCookType(const std::string& path);
+		static const char* GetCookTypeName(CookType type);
+
+		// Splits a "#type" separated source into its stages
+		static bool CookShader(const uint8_t* source, size_t size, std::vector<uint8_t>& out);
+		// Decodes to RGBA8, flips to bottom-up rows, adds a box filtered mip chain down to 1x1 and
+		// stores every level as separately compressed row strips
+		static bool CookTexture(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+		// Images named *.virtual.<ext>: pads to a square power of two number of pages, builds the mip
+		// chain and cuts every level into separately compressed, bordered pages
+		static bool CookVirtualTexture(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+
+	private:
+		struct Dependency
+		{
+			std::string Path;
+			uint64_t Hash = 0;
+		};
+
+		struct ManifestEntry
+		{
+			CookType Type = CookType::Copy;
+			uint32_t CookerVersion = 0;
+			uint64_t OutputSize = 0;
+			std::vector<Dependency> Dependencies;
+		};
+
+		struct Source
+		{
+			std::string Path;
+			std::string DiskPath;
+		};
+
+		void LoadManifest();
+		bool SaveManifest() const;
+		std::string GetManifestPath() const;
+		std::string GetOutputPath(const std::string& path) const;
+
+	private:
+		std::string m_OutputDirectory;
+		std::vector<Source> m_Sources;
+		std::unordered_map<std::string, size_t> m_SourceIndices;
+		std::unordered_map<std::string, ManifestEntry> m_Manifest;
+		CookStats m_Stats;
+	};
+}
@@ -0,0 +1,203 @@
+#include "rmpch.h"
+#include "AssetManager.h"
+
+#include "RoMan/Asset/PackFormat.h"
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+#include <list>
+
+namespace RoMan
+{
+	struct AssetEntry
+	{
+		std::string Path;
+		AssetType Type;
+		Ref<RefCounted> Asset;
+		uint64_t Size = 0;
+		uint64_t UseCount = 0;
+		uint32_t LastUsedFrame = 0;
+		std::list<AssetID>::iterator LRUPosition;
+	};
+
+	struct AssetManagerData
+	{
+		std::unordered_map<AssetID, AssetEntry> Assets;
+		std::list<AssetID> LRU; // Most recently used first
+
+		uint64_t MemoryBudget = 0;
+		uint64_t MemoryUsage = 0;
+
+		uint64_t Hits = 0;
+		uint64_t Misses = 0;
+		uint64_t Evictions = 0;
+	};
+
+	static AssetManagerData* s_Data = nullptr;
+
+	void AssetManager::Init(uint64_t memoryBudget)
+	{
+		RM_CORE_ASSERT(!s_Data, "AssetManager already initialized!");
+
+		RM_MEMORY_SCOPE(MemoryTag::Asset);
+		s_Data = new AssetManagerData();
+		s_Data->MemoryBudget = memoryBudget;
+	}
+
+	void AssetManager::Shutdown()
+	{
+		// Only the cache's references go away, assets layers still hold are released with them
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	AssetID AssetManager::GetAssetID(const std::string& path)
+	{
+		std::string normalized = NormalizePackPath(path);
+		return HashPackPath(normalized.data(), normalized.size());
+	}
+
+	bool AssetManager::IsLoaded(AssetID id)
+	{
+		RM_CORE_ASSERT(s_Data, "AssetManager not initialized!");
+		return s_Data->Assets.find(id) != s_Data->Assets.end();
+	}
+
+	Ref<RefCounted> AssetManager::Acquire(AssetID id, AssetType type)
+	{
+		RM_CORE_ASSERT(s_Data, "AssetManager not initialized!");
+
+		auto it = s_Data->Assets.find(id);
+		if (it == s_Data->Assets.end())
+		{
+			s_Data->Misses++;
+			return nullptr;
+		}
+
+		AssetEntry& entry = it->second;
+		RM_CORE_ASSERT(entry.Type == type, "Asset loaded with a different type!");
+
+		entry.UseCount++;
+		entry.LastUsedFrame = FrameStats::GetFrameCount();
+		s_Data->LRU.splice(s_Data->LRU.begin(), s_Data->LRU, entry.LRUPosition);
+		s_Data->Hits++;
+
+		return entry.Asset;
+	}
+
+	void AssetManager::Insert(AssetID id, AssetType type, const std::string& path, const Ref<RefCounted>& asset, uint64_t size)
+	{
+		RM_MEMORY_SCOPE(MemoryTag::Asset);
+
+		s_Data->LRU.push_front(id);
+
+		AssetEntry& entry = s_Data->Assets[id];
+		entry.Path = NormalizePackPath(path);
+		entry.Type = type;
+		entry.Asset = asset;
+		entry.Size = size;
+		entry.UseCount = 1;
+		entry.LastUsedFrame = FrameStats::GetFrameCount();
+		entry.LRUPosition = s_Data->LRU.begin();
+
+		s_Data->MemoryUsage += size;
+		EnforceBudget();
+	}
+
+	void AssetManager::EnforceBudget()
+	{
+		// Only assets the cache alone holds can go, unloading anything else wouldn't free memory
+		auto it = s_Data->LRU.end();
+		while (s_Data->MemoryUsage > s_Data->MemoryBudget && it != s_Data->LRU.begin())
+		{
+			--it;
+			auto entryIt = s_Data->Assets.find(*it);
+			if (entryIt->second.Asset->GetRefCount() > 1)
+				continue;
+
+			RM_CORE_TRACE("Evicting asset {0} ({1} KB)", entryIt->second.Path, entryIt->second.Size / 1024);
+			s_Data->MemoryUsage -= entryIt->second.Size;
+			s_Data->Evictions++;
+			s_Data->Assets.erase(entryIt);
+			it = s_Data->LRU.erase(it);
+		}
+	}
+
+	uint32_t AssetManager::UnloadUnused()
+	{
+		RM_CORE_ASSERT(s_Data, "AssetManager not initialized!");
+
+		uint32_t count = 0;
+		for (auto it = s_Data->LRU.begin(); it != s_Data->LRU.end();)
+		{
+			auto entryIt = s_Data->Assets.find(*it);
+			if (entryIt->second.Asset->GetRefCount() > 1)
+			{
+				++it;
+				continue;
+			}
+
+			s_Data->MemoryUsage -= entryIt->second.Size;
+			s_Data->Assets.erase(entryIt);
+			it = s_Data->LRU.erase(it);
+			count++;
+		}
+		return count;
+	}
+
+	void AssetManager::SetMemoryBudget(uint64_t bytes)
+	{
+		RM_CORE_ASSERT(s_Data, "AssetManager not initialized!");
+
+		s_Data->MemoryBudget = bytes;
+		EnforceBudget();
+	}
+
+	AssetManagerStats AssetManager::GetStats()
+	{
+		AssetManagerStats stats;
+		if (!s_Data)
+			return stats;
+
+		stats.AssetCount = (uint32_t)s_Data->Assets.size();
+		stats.MemoryUsage = s_Data->MemoryUsage;
+		stats.MemoryBudget = s_Data->MemoryBudget;
+		stats.Hits = s_Data->Hits;
+		stats.Misses = s_Data->Misses;
+		stats.Evictions = s_Data->Evictions;
+		return stats;
+	}
+
+	std::vector<AssetInfo> AssetManager::GetResidentAssets()
+	{
+		std::vector<AssetInfo> assets;
+		if (!s_Data)
+			return assets;
+
+		assets.reserve(s_Data->Assets.size());
+		for (AssetID id : s_Data->LRU)
+		{
+			const AssetEntry& entry = s_Data->Assets[id];
+			AssetInfo& info = assets.emplace_back();
+			info.Path = entry.Path;
+			info.Type = entry.Type;
+			info.Size = entry.Size;
+			// The cache's own reference isn't a user
+			info.References = entry.Asset->GetRefCount() - 1;
+			info.LastUsedFrame = entry.LastUsedFrame;
+		}
+		return assets;
+	}
+
+	const char* AssetManager::GetTypeName(AssetType type)
+	{
+		switch (type)
+		{
+			case AssetType::Texture2D: return "Texture2D";
+			case AssetType::Shader:    return "Shader";
+		}
+
+		RM_CORE_ASSERT(false, "Unknown AssetType!");
+		return "Unknown";
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "RoMan/Core.h"
+#include "RoMan/Renderer/Shader.h"
+#include "RoMan/Renderer/Texture.h"
+
+#include <string>
+
+namespace RoMan
+{
+	// Stable across runs, derived from the normalized path
+	using AssetID = uint64_t;
+
+	enum class AssetType : uint8_t
+	{
+		Texture2D = 0, Shader,
+		Count
+	};
+
+	// Tells the AssetManager how to load and size an asset type. New asset types (e.g. meshes)
+	// specialize this next to their class.
+	template<typename T>
+	struct AssetTraits;
+
+	template<>
+	struct AssetTraits<Texture2D>
+	{
+		static constexpr AssetType Type = AssetType::Texture2D;
+		static Ref<Texture2D> Load(const std::string& path) { return Texture2D::Create(path); }
+		static uint64_t GetMemorySize(const Texture2D& texture) { return texture.GetMemorySize(); }
+	};
+
+	template<>
+	struct AssetTraits<Shader>
+	{
+		static constexpr AssetType Type = AssetType::Shader;
+		static Ref<Shader> Load(const std::string& path) { return Shader::Create(path); }
+		static uint64_t GetMemorySize(const Shader&) { return 0; }
+	};
+
+	struct AssetManagerStats
+	{
+		uint32_t AssetCount = 0;
+		uint64_t MemoryUsage = 0;
+		uint64_t MemoryBudget = 0;
+		uint64_t Hits = 0;
+		uint64_t Misses = 0;
+		uint64_t Evictions = 0;
+	};
+
+	struct AssetInfo
+	{
+		std::string Path;
+		AssetType Type;
+		uint64_t Size = 0;
+		uint32_t References = 0; // Outside the cache
+		uint32_t LastUsedFrame = 0;
+	};
+
+	// Cache in front of asset loading. Loading a path that is already resident returns the same
+	// Ref instead of decoding and uploading again. Assets nobody else references stay cached until
+	// the memory budget is exceeded, then the least recently used of them are unloaded first.
+	// Main thread only, loaders create GPU resources.
+	class AssetManager
+	{
+	public:
+		static void Init(uint64_t memoryBudget = 512ull * 1024 * 1024);
+		static void Shutdown();
+
+		template<typename T>
+		static Ref<T> Load(const std::string& path)
+		{
+			AssetID id = GetAssetID(path);
+			if (Ref<RefCounted> asset = Acquire(id, AssetTraits<T>::Type))
+				return asset.As<T>();
+
+			Ref<T> asset = AssetTraits<T>::Load(path);
+			if (asset)
+				Insert(id, AssetTraits<T>::Type, path, asset, AssetTraits<T>::GetMemorySize(*asset));
+			return asset;
+		}
+
+		// nullptr if the asset isn't resident, doesn't load it
+		template<typename T>
+		static Ref<T> Get(AssetID id)
+		{
+			Ref<RefCounted> asset = Acquire(id, AssetTraits<T>::Type);
+			return asset ? asset.As<T>() : nullptr;
+		}
+
+		static AssetID GetAssetID(const std::string& path);
+		static bool IsLoaded(AssetID id);
+
+		// Drops every asset only the cache still references, regardless of the budget
+		static uint32_t UnloadUnused();
+
+		static void SetMemoryBudget(uint64_t bytes);
+		static AssetManagerStats GetStats();
+		// Most recently used first
+		static std::vector<AssetInfo> GetResidentAssets();
+
+		static const char* GetTypeName(AssetType type);
+
+	private:
+		static Ref<RefCounted> Acquire(AssetID id, AssetType type);
+		static void Insert(AssetID id, AssetType type, const std::string& path, const Ref<RefCounted>& asset, uint64_t size);
+		static void EnforceBudget();
+	};
+}
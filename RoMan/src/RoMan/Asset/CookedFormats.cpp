@@ -0,0 +1,335 @@
+#include "rmpch.h"
+#include "CookedFormats.h"
+
+#include "RoMan/Core/Compression.h"
+#include "RoMan/Core/ThreadPool.h"
+
+#include <atomic>
+
+namespace RoMan
+{
+	static bool ParseShaderStage(std::string_view type, ShaderStage& stage)
+	{
+		while (!type.empty() && (type.back() == ' ' || type.back() == '\t'))
+			type.remove_suffix(1);
+
+		if (type == "vertex")
+			stage = ShaderStage::Vertex;
+		else if (type == "fragment")
+			stage = ShaderStage::Fragment;
+		else
+			return false;
+
+		return true;
+	}
+
+	bool SplitShaderSource(std::string_view source, ShaderStageSources& out)
+	{
+		out.clear();
+
+		const std::string_view typeToken = "#type";
+		size_t pos = source.find(typeToken, 0);
+		while (pos != std::string_view::npos)
+		{
+			size_t eol = source.find_first_of("\r\n", pos);
+			if (eol == std::string_view::npos)
+			{
+				RM_CORE_ERROR("Shader stage has no source after its #type line");
+				return false;
+			}
+
+			ShaderStage stage;
+			size_t begin = std::min(pos + typeToken.size() + 1, eol);
+			if (!ParseShaderStage(source.substr(begin, eol - begin), stage))
+			{
+				RM_CORE_ERROR("Invalid shader type {0}", source.substr(begin, eol - begin));
+				return false;
+			}
+
+			size_t nextLinePos = source.find_first_not_of("\r\n", eol);
+			pos = nextLinePos == std::string_view::npos ? std::string_view::npos : source.find(typeToken, nextLinePos);
+
+			std::string stageSource = nextLinePos == std::string_view::npos ? std::string() : std::string(source.substr(nextLinePos, pos - nextLinePos));
+			auto it = std::find_if(out.begin(), out.end(), [stage](const auto& existing) { return existing.first == stage; });
+			if (it != out.end())
+				it->second = std::move(stageSource);
+			else
+				out.emplace_back(stage, std::move(stageSource));
+		}
+
+		if (out.empty())
+		{
+			RM_CORE_ERROR("Shader has no #type sections");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool ReadShaderSources(const uint8_t* data, size_t size, ShaderStageSources& out)
+	{
+		if (!IsCookedShader(data, size))
+			return SplitShaderSource(std::string_view((const char*)data, size), out);
+
+		// Already split by RoManCook
+		CookedShader cooked;
+		out.clear();
+		if (!ReadCookedShader(data, size, cooked))
+			return false;
+
+		for (const auto& [stage, stageSource] : cooked.Stages)
+			out.emplace_back(stage, std::string(stageSource));
+		return true;
+	}
+
+	bool ReadCookedShader(const uint8_t* data, size_t size, CookedShader& out)
+	{
+		out.Stages.clear();
+
+		if (size < sizeof(CookedShaderHeader))
+		{
+			RM_CORE_ERROR("Cooked shader is truncated");
+			return false;
+		}
+
+		const CookedShaderHeader& header = *(const CookedShaderHeader*)data;
+		if (header.Magic != CookedShaderMagic || header.Version != CookedShaderVersion)
+		{
+			RM_CORE_ERROR("Cooked shader has an unknown magic or version {0}, recook it", header.Version);
+			return false;
+		}
+
+		size_t offset = sizeof(CookedShaderHeader);
+		for (uint32_t i = 0; i < header.StageCount; i++)
+		{
+			if (size - offset < sizeof(CookedShaderStage))
+			{
+				RM_CORE_ERROR("Cooked shader is truncated");
+				return false;
+			}
+
+			CookedShaderStage stage;
+			memcpy(&stage, data + offset, sizeof(stage));
+			offset += sizeof(stage);
+
+			if (stage.Stage > (uint32_t)ShaderStage::Fragment || size - offset < stage.Size)
+			{
+				RM_CORE_ERROR("Cooked shader has an invalid stage {0}", i);
+				return false;
+			}
+
+			out.Stages.emplace_back((ShaderStage)stage.Stage, std::string_view((const char*)data + offset, stage.Size));
+			offset += stage.Size;
+		}
+
+		return true;
+	}
+
+	bool ReadCookedTexture(const uint8_t* data, size_t size, CookedTexture& out)
+	{
+		if (size < sizeof(CookedTextureHeader))
+		{
+			RM_CORE_ERROR("Cooked texture is truncated");
+			return false;
+		}
+
+		const CookedTextureHeader* header = (const CookedTextureHeader*)data;
+		if (header->Magic != CookedTextureMagic || header->Version != CookedTextureVersion)
+		{
+			RM_CORE_ERROR("Cooked texture has an unknown magic or version {0}, recook it", header->Version);
+			return false;
+		}
+
+		if (header->Format != (uint32_t)CookedTextureFormat::RGBA8 || header->Width == 0 || header->Height == 0 ||
+			header->MipCount == 0 || header->MipCount > 32 || header->StripHeight == 0 ||
+			(size - sizeof(CookedTextureHeader)) / sizeof(CookedTextureMip) < header->MipCount)
+		{
+			RM_CORE_ERROR("Cooked texture has an invalid header");
+			return false;
+		}
+
+		const CookedTextureMip* mips = (const CookedTextureMip*)(data + sizeof(CookedTextureHeader));
+		size_t stripsOffset = sizeof(CookedTextureHeader) + sizeof(CookedTextureMip) * header->MipCount;
+		size_t stripCount = 0;
+
+		uint32_t width = header->Width, height = header->Height;
+		for (uint32_t i = 0; i < header->MipCount; i++)
+		{
+			const CookedTextureMip& mip = mips[i];
+			if (mip.Width != width || mip.Height != height || mip.Size != (uint64_t)width * height * 4 ||
+				mip.FirstStrip != stripCount || mip.StripCount != (height + header->StripHeight - 1) / header->StripHeight)
+			{
+				RM_CORE_ERROR("Cooked texture has an invalid mip level {0}", i);
+				return false;
+			}
+
+			stripCount += mip.StripCount;
+			width = std::max(width / 2, 1u);
+			height = std::max(height / 2, 1u);
+		}
+
+		if ((size - stripsOffset) / sizeof(CookedTextureStrip) < stripCount)
+		{
+			RM_CORE_ERROR("Cooked texture is truncated");
+			return false;
+		}
+
+		out.Header = header;
+		out.Mips = mips;
+		out.Strips = (const CookedTextureStrip*)(data + stripsOffset);
+		out.Data = data;
+
+		for (uint32_t level = 0; level < header->MipCount; level++)
+		{
+			for (uint32_t i = 0; i < mips[level].StripCount; i++)
+			{
+				const CookedTextureStrip& strip = out.Strips[mips[level].FirstStrip + i];
+				uint64_t rowsSize = (uint64_t)out.GetStripRows(level, i) * mips[level].Width * 4;
+				if (strip.Offset > size || size - strip.Offset < strip.StoredSize ||
+					strip.Compression > (uint32_t)CompressionType::LZ4 ||
+					(strip.Compression == (uint32_t)CompressionType::None && strip.StoredSize != rowsSize))
+				{
+					RM_CORE_ERROR("Cooked texture has an invalid strip {0} in mip level {1}", i, level);
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	bool ReadCookedVirtualTexture(const uint8_t* data, size_t size, CookedVirtualTexture& out)
+	{
+		if (size < sizeof(CookedVirtualTextureHeader))
+		{
+			RM_CORE_ERROR("Cooked virtual texture is truncated");
+			return false;
+		}
+
+		const CookedVirtualTextureHeader* header = (const CookedVirtualTextureHeader*)data;
+		if (header->Magic != CookedVirtualTextureMagic || header->Version != CookedVirtualTextureVersion)
+		{
+			RM_CORE_ERROR("Cooked virtual texture has an unknown magic or version {0}, recook it", header->Version);
+			return false;
+		}
+
+		if (header->Width == 0 || header->Height == 0 || header->PageSize == 0 || header->PageSize > 1024 ||
+			header->Border > header->PageSize || header->MipCount == 0 || header->MipCount > 16 ||
+			(size - sizeof(CookedVirtualTextureHeader)) / sizeof(CookedVirtualTextureMip) < header->MipCount)
+		{
+			RM_CORE_ERROR("Cooked virtual texture has an invalid header");
+			return false;
+		}
+
+		const CookedVirtualTextureMip* mips = (const CookedVirtualTextureMip*)(data + sizeof(CookedVirtualTextureHeader));
+		uint32_t pageCount = 0;
+		for (uint32_t i = 0; i < header->MipCount; i++)
+		{
+			uint32_t pagesPerSide = 1u << (header->MipCount - 1 - i);
+			if (mips[i].PagesPerSide != pagesPerSide || mips[i].FirstPage != pageCount)
+			{
+				RM_CORE_ERROR("Cooked virtual texture has an invalid mip level {0}", i);
+				return false;
+			}
+			pageCount += pagesPerSide * pagesPerSide;
+		}
+
+		size_t pagesOffset = sizeof(CookedVirtualTextureHeader) + sizeof(CookedVirtualTextureMip) * header->MipCount;
+		if (header->PageCount != pageCount || (size - pagesOffset) / sizeof(CookedVirtualTexturePage) < pageCount)
+		{
+			RM_CORE_ERROR("Cooked virtual texture is truncated");
+			return false;
+		}
+
+		out.Header = header;
+		out.Mips = mips;
+		out.Pages = (const CookedVirtualTexturePage*)(data + pagesOffset);
+		out.Data = data;
+
+		for (uint32_t i = 0; i < pageCount; i++)
+		{
+			const CookedVirtualTexturePage& page = out.Pages[i];
+			if (page.Offset > size || size - page.Offset < page.StoredSize || page.Compression > (uint32_t)CompressionType::LZ4 ||
+				(page.Compression == (uint32_t)CompressionType::None && page.StoredSize != out.GetPageSize()))
+			{
+				RM_CORE_ERROR("Cooked virtual texture has an invalid page {0}", i);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool ReadCookedVirtualTexturePage(const CookedVirtualTexture& texture, uint32_t page, uint8_t* out)
+	{
+		const CookedVirtualTexturePage& entry = texture.Pages[page];
+		if (entry.Compression == (uint32_t)CompressionType::None)
+		{
+			memcpy(out, texture.Data + entry.Offset, entry.StoredSize);
+			return true;
+		}
+
+		return Compression::Decompress((CompressionType)entry.Compression, texture.Data + entry.Offset, entry.StoredSize, out, texture.GetPageSize());
+	}
+
+	bool StreamCookedTexture(const CookedTexture& texture, std::vector<uint8_t>& staging, size_t stagingBudget, const CookedTextureStripFunc& func)
+	{
+		// The first level has the widest strips, every batch slot is sized for one of those
+		size_t slotSize = (size_t)texture.Header->StripHeight * texture.Header->Width * 4;
+		uint32_t slotCount = (uint32_t)std::max<size_t>(stagingBudget / slotSize, 1);
+
+		bool needsStaging = false;
+		for (uint32_t level = 0; level < texture.Header->MipCount && !needsStaging; level++)
+		{
+			const CookedTextureMip& mip = texture.Mips[level];
+			for (uint32_t i = 0; i < mip.StripCount && !needsStaging; i++)
+				needsStaging = texture.Strips[mip.FirstStrip + i].Compression != (uint32_t)CompressionType::None;
+		}
+
+		if (needsStaging && staging.size() < slotSize * slotCount)
+			staging.resize(slotSize * slotCount);
+
+		std::vector<const uint8_t*> pixels(slotCount);
+		std::atomic<bool> failed{ false };
+		for (uint32_t level = 0; level < texture.Header->MipCount; level++)
+		{
+			const CookedTextureMip& mip = texture.Mips[level];
+			for (uint32_t first = 0; first < mip.StripCount; first += slotCount)
+			{
+				uint32_t batchCount = std::min(slotCount, mip.StripCount - first);
+				ThreadPool::ParallelFor(batchCount, 1, [&](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; i++)
+					{
+						const CookedTextureStrip& strip = texture.Strips[mip.FirstStrip + first + i];
+						if (strip.Compression == (uint32_t)CompressionType::None)
+						{
+							pixels[i] = texture.Data + strip.Offset;
+							continue;
+						}
+
+						uint8_t* slot = staging.data() + slotSize * i;
+						size_t rowsSize = (size_t)texture.GetStripRows(level, first + i) * mip.Width * 4;
+						if (!Compression::Decompress((CompressionType)strip.Compression, texture.Data + strip.Offset, strip.StoredSize, slot, rowsSize))
+							failed.store(true, std::memory_order_relaxed);
+						pixels[i] = slot;
+					}
+				});
+
+				if (failed.load(std::memory_order_relaxed))
+				{
+					RM_CORE_ERROR("Cooked texture has a corrupt strip in mip level {0}", level);
+					return false;
+				}
+
+				for (uint32_t i = 0; i < batchCount; i++)
+				{
+					uint32_t strip = first + i;
+					func(level, strip * texture.Header->StripHeight, texture.GetStripRows(level, strip), pixels[i]);
+				}
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace RoMan
+{
+	// Files written by RoManCook. They keep the path of their source, so a pack built from the cooked
+	// tree shadows the loose sources and loaders tell the two apart by the magic. Little endian.
+	static constexpr uint32_t CookedShaderMagic = 0x48534D52;  // "RMSH"
+	static constexpr uint32_t CookedTextureMagic = 0x58544D52; // "RMTX"
+	static constexpr uint32_t CookedVirtualTextureMagic = 0x54564D52; // "RMVT"
+	static constexpr uint32_t CookedShaderVersion = 1;
+	static constexpr uint32_t CookedTextureVersion = 2;
+	static constexpr uint32_t CookedVirtualTextureVersion = 1;
+
+	enum class ShaderStage : uint32_t
+	{
+		Vertex = 0, Fragment
+	};
+
+	// CookedShaderHeader, then StageCount times a CookedShaderStage followed by Size bytes of source
+	// with the #type line already stripped
+	struct CookedShaderHeader
+	{
+		uint32_t Magic = CookedShaderMagic;
+		uint32_t Version = CookedShaderVersion;
+		uint32_t StageCount = 0;
+		uint32_t Reserved = 0;
+	};
+
+	struct CookedShaderStage
+	{
+		uint32_t Stage = 0; // ShaderStage
+		uint32_t Size = 0;
+	};
+
+	enum class CookedTextureFormat : uint32_t
+	{
+		RGBA8 = 0
+	};
+
+	// CookedTextureHeader, CookedTextureMip[MipCount], CookedTextureStrip[total strip count], then the
+	// strip data. Every level is split into strips of StripHeight rows (the last one may be shorter)
+	// compressed on their own, so huge textures decode in parallel and upload through a small
+	// staging buffer. Rows are tightly packed and bottom-up, ready to hand to the GPU as is.
+	struct CookedTextureHeader
+	{
+		uint32_t Magic = CookedTextureMagic;
+		uint32_t Version = CookedTextureVersion;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t Format = 0; // CookedTextureFormat
+		uint32_t MipCount = 0;
+		uint32_t StripHeight = 0;
+		uint32_t Reserved = 0;
+	};
+
+	struct CookedTextureMip
+	{
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t FirstStrip = 0;
+		uint32_t StripCount = 0;
+		uint64_t Size = 0; // Decompressed
+	};
+
+	struct CookedTextureStrip
+	{
+		uint64_t Offset = 0;      // From the start of the file
+		uint32_t StoredSize = 0;
+		uint32_t Compression = 0; // CompressionType
+	};
+
+	// CookedVirtualTextureHeader, CookedVirtualTextureMip[MipCount], CookedVirtualTexturePage[PageCount],
+	// then the page data. The image is padded to a square, power of two number of pages so every
+	// level halves the page grid down to a single page. A page holds PageSize^2 texels plus Border
+	// texels of its neighbours on each side (clamped at the edges), so bilinear filtering in the
+	// cache atlas never bleeds into another page. Pages are RGBA8, bottom-up, ordered by level then
+	// row, and compressed on their own so they can be loaded one at a time.
+	struct CookedVirtualTextureHeader
+	{
+		uint32_t Magic = CookedVirtualTextureMagic;
+		uint32_t Version = CookedVirtualTextureVersion;
+		uint32_t Width = 0;  // Of the source image, before padding
+		uint32_t Height = 0;
+		uint32_t PageSize = 0;
+		uint32_t Border = 0;
+		uint32_t MipCount = 0;
+		uint32_t PageCount = 0;
+	};
+
+	struct CookedVirtualTextureMip
+	{
+		uint32_t PagesPerSide = 0;
+		uint32_t FirstPage = 0;
+	};
+
+	struct CookedVirtualTexturePage
+	{
+		uint64_t Offset = 0;      // From the start of the file
+		uint32_t StoredSize = 0;
+		uint32_t Compression = 0; // CompressionType
+	};
+
+	static_assert(sizeof(CookedShaderHeader) == 16, "CookedShaderHeader layout changed");
+	static_assert(sizeof(CookedShaderStage) == 8, "CookedShaderStage layout changed");
+	static_assert(sizeof(CookedTextureHeader) == 32, "CookedTextureHeader layout changed");
+	static_assert(sizeof(CookedTextureMip) == 24, "CookedTextureMip layout changed");
+	static_assert(sizeof(CookedTextureStrip) == 16, "CookedTextureStrip layout changed");
+	static_assert(sizeof(CookedVirtualTextureHeader) == 32, "CookedVirtualTextureHeader layout changed");
+	static_assert(sizeof(CookedVirtualTextureMip) == 8, "CookedVirtualTextureMip layout changed");
+	static_assert(sizeof(CookedVirtualTexturePage) == 16, "CookedVirtualTexturePage layout changed");
+
+	// Stage sources in file order, at most one per stage
+	using ShaderStageSources = std::vector<std::pair<ShaderStage, std::string>>;
+
+	// Views into the file data, valid as long as it is
+	struct CookedShader
+	{
+		std::vector<std::pair<ShaderStage, std::string_view>> Stages;
+	};
+
+	struct CookedTexture
+	{
+		const CookedTextureHeader* Header = nullptr;
+		const CookedTextureMip* Mips = nullptr;
+		const CookedTextureStrip* Strips = nullptr;
+		const uint8_t* Data = nullptr;
+
+		uint32_t GetStripRows(uint32_t level, uint32_t strip) const
+		{
+			return std::min(Header->StripHeight, Mips[level].Height - strip * Header->StripHeight);
+		}
+	};
+
+	struct CookedVirtualTexture
+	{
+		const CookedVirtualTextureHeader* Header = nullptr;
+		const CookedVirtualTextureMip* Mips = nullptr;
+		const CookedVirtualTexturePage* Pages = nullptr;
+		const uint8_t* Data = nullptr;
+
+		uint32_t GetSlotSize() const { return Header->PageSize + Header->Border * 2; }
+		// Bytes of one decompressed page, borders included
+		size_t GetPageSize() const { return (size_t)GetSlotSize() * GetSlotSize() * 4; }
+	};
+
+	// Called once per strip, in order within a level, with y and rows in texels of that level
+	using CookedTextureStripFunc = std::function<void(uint32_t level, uint32_t y, uint32_t rows, const uint8_t* pixels)>;
+
+	inline bool IsCookedShader(const uint8_t* data, size_t size)
+	{
+		return size >= sizeof(uint32_t) && *(const uint32_t*)data == CookedShaderMagic;
+	}
+
+	inline bool IsCookedTexture(const uint8_t* data, size_t size)
+	{
+		return size >= sizeof(uint32_t) && *(const uint32_t*)data == CookedTextureMagic;
+	}
+
+	inline bool IsCookedVirtualTexture(const uint8_t* data, size_t size)
+	{
+		return size >= sizeof(uint32_t) && *(const uint32_t*)data == CookedVirtualTextureMagic;
+	}
+
+	// Splits "#type vertex" / "#type fragment" separated source, a later section of a stage replaces
+	// an earlier one. False with an error logged if a #type line is invalid or there is none.
+	bool SplitShaderSource(std::string_view source, ShaderStageSources& out);
+	// A shader file as loaded, cooked by RoManCook or "#type" separated text
+	bool ReadShaderSources(const uint8_t* data, size_t size, ShaderStageSources& out);
+
+	// Validate every size and offset, false with an error logged if the file is malformed
+	bool ReadCookedShader(const uint8_t* data, size_t size, CookedShader& out);
+	bool ReadCookedTexture(const uint8_t* data, size_t size, CookedTexture& out);
+	bool ReadCookedVirtualTexture(const uint8_t* data, size_t size, CookedVirtualTexture& out);
+	// Decompresses one page into GetPageSize() bytes at out, safe from any thread
+	bool ReadCookedVirtualTexturePage(const CookedVirtualTexture& texture, uint32_t page, uint8_t* out);
+
+	// Decompresses the strips of every level in batches of at most stagingBudget bytes, spread over
+	// the ThreadPool, and hands each one to func. staging is grown to the batch size and can be reused
+	// across textures, raw strips point straight into the file data. Peak memory is the staging
+	// buffer, whatever the texture size.
+	bool StreamCookedTexture(const CookedTexture& texture, std::vector<uint8_t>& staging, size_t stagingBudget, const CookedTextureStripFunc& func);
+}
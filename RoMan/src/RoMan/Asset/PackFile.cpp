@@ -0,0 +1,110 @@
+#include "rmpch.h"
+#include "PackFile.h"
+
+#include "RoMan/Core/Compression.h"
+
+#include <cstring>
+
+namespace RoMan
+{
+	bool PackFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		if (!m_File.Open(filepath))
+			return false;
+
+		m_Path = filepath;
+		if (!Validate())
+		{
+			RM_CORE_ERROR("{0} is not a valid pack file", filepath);
+			m_File.Close();
+			return false;
+		}
+
+		const uint8_t* data = m_File.GetData();
+		m_Header = (const PackHeader*)data;
+		m_Entries = (const PackEntry*)(data + m_Header->EntriesOffset);
+		m_Strings = (const char*)(data + m_Header->StringsOffset);
+		return true;
+	}
+
+	void PackFile::Close()
+	{
+		m_File.Close();
+		m_Header = nullptr;
+		m_Entries = nullptr;
+		m_Strings = nullptr;
+	}
+
+	bool PackFile::Validate() const
+	{
+		uint64_t fileSize = m_File.GetSize();
+		if (fileSize < sizeof(PackHeader))
+			return false;
+
+		const PackHeader& header = *(const PackHeader*)m_File.GetData();
+		if (header.Magic != PackMagic)
+			return false;
+
+		if (header.Version != PackVersion)
+		{
+			RM_CORE_ERROR("Pack version {0} isn't supported (expected {1})", header.Version, PackVersion);
+			return false;
+		}
+
+		// Every offset is checked once here so lookups and reads don't have to
+		uint64_t entriesSize = (uint64_t)header.EntryCount * sizeof(PackEntry);
+		if (header.EntriesOffset % alignof(PackEntry) != 0 || header.EntriesOffset > fileSize || entriesSize > fileSize - header.EntriesOffset)
+			return false;
+		if (header.StringsOffset > fileSize || header.StringsSize > fileSize - header.StringsOffset)
+			return false;
+
+		const PackEntry* entries = (const PackEntry*)(m_File.GetData() + header.EntriesOffset);
+		for (uint32_t i = 0; i < header.EntryCount; i++)
+		{
+			const PackEntry& entry = entries[i];
+			if (entry.Offset > fileSize || entry.StoredSize > fileSize - entry.Offset)
+				return false;
+			if ((uint64_t)entry.PathOffset + entry.PathLength > header.StringsSize)
+				return false;
+			if (entry.Compression > (uint32_t)CompressionType::LZ4)
+				return false;
+			// Uncompressed entries are read straight from the mapping, Size bytes of them
+			if (entry.Compression == (uint32_t)CompressionType::None && entry.Size != entry.StoredSize)
+				return false;
+		}
+
+		return true;
+	}
+
+	const PackEntry* PackFile::Find(const std::string& path) const
+	{
+		if (!m_Header)
+			return nullptr;
+
+		uint64_t hash = HashPackPath(path.data(), path.size());
+
+		const PackEntry* end = m_Entries + m_Header->EntryCount;
+		const PackEntry* entry = std::lower_bound(m_Entries, end, hash,
+			[](const PackEntry& e, uint64_t value) { return e.PathHash < value; });
+
+		for (; entry != end && entry->PathHash == hash; entry++)
+		{
+			if (entry->PathLength == path.size() && memcmp(m_Strings + entry->PathOffset, path.data(), path.size()) == 0)
+				return entry;
+		}
+
+		return nullptr;
+	}
+
+	bool PackFile::Read(const PackEntry& entry, void* dst) const
+	{
+		if (!Compression::Decompress((CompressionType)entry.Compression, GetStoredData(entry), entry.StoredSize, dst, entry.Size))
+		{
+			RM_CORE_ERROR("Corrupt entry {0} in {1}", GetEntryPath(entry), m_Path);
+			return false;
+		}
+		return true;
+	}
+}
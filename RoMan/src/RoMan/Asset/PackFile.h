@@ -0,0 +1,42 @@
+#pragma once
+
+#include "RoMan/Asset/PackFormat.h"
+#include "RoMan/Core/MappedFile.h"
+
+namespace RoMan
+{
+	// Read-only access to a mapped .rmpak archive. Lookups binary search the table of contents and
+	// reads come straight from the mapping, safe to call from any thread once opened.
+	class PackFile
+	{
+	public:
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool IsOpen() const { return m_Header != nullptr; }
+		const std::string& GetPath() const { return m_Path; }
+
+		// Takes a normalized path, nullptr if the archive doesn't contain it
+		const PackEntry* Find(const std::string& path) const;
+
+		// dst must hold entry.Size bytes
+		bool Read(const PackEntry& entry, void* dst) const;
+		// Bytes as stored, i.e. still compressed unless entry.Compression is None
+		const uint8_t* GetStoredData(const PackEntry& entry) const { return m_File.GetData() + entry.Offset; }
+
+		uint32_t GetEntryCount() const { return m_Header ? m_Header->EntryCount : 0; }
+		const PackEntry* GetEntries() const { return m_Entries; }
+		std::string GetEntryPath(const PackEntry& entry) const { return std::string(m_Strings + entry.PathOffset, entry.PathLength); }
+
+	private:
+		bool Validate() const;
+
+	private:
+		std::string m_Path;
+		MappedFile m_File;
+
+		const PackHeader* m_Header = nullptr;
+		const PackEntry* m_Entries = nullptr;
+		const char* m_Strings = nullptr;
+	};
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "RoMan/Core.h"
+#include "RoMan/Core/Hash.h"
+
+#include <string>
+
+namespace RoMan
+{
+	// Layout of a .rmpak archive, little endian:
+	//   PackHeader
+	//   blobs, each starting on a multiple of Alignment
+	//   PackEntry[EntryCount], sorted by PathHash then path
+	//   path strings, not null terminated
+	static constexpr uint32_t PackMagic = 0x4B504D52; // "RMPK"
+	static constexpr uint32_t PackVersion = 1;
+
+	struct PackHeader
+	{
+		uint32_t Magic = PackMagic;
+		uint32_t Version = PackVersion;
+		uint32_t EntryCount = 0;
+		uint32_t Alignment = 0;
+		uint64_t EntriesOffset = 0;
+		uint64_t StringsOffset = 0;
+		uint64_t StringsSize = 0;
+	};
+
+	struct PackEntry
+	{
+		uint64_t PathHash = 0;
+		uint64_t Offset = 0;
+		uint64_t Size = 0;        // Once decompressed
+		uint64_t StoredSize = 0;  // In the archive
+		uint32_t PathOffset = 0;  // Into the string table
+		uint32_t PathLength = 0;
+		uint32_t Compression = 0; // CompressionType
+		uint32_t Reserved = 0;
+	};
+
+	static_assert(sizeof(PackHeader) == 40, "PackHeader layout changed");
+	static_assert(sizeof(PackEntry) == 48, "PackEntry layout changed");
+
+	// Paths are stored with forward slashes and without a leading "./"
+	inline std::string NormalizePackPath(const std::string& path)
+	{
+		std::string result = path;
+		std::replace(result.begin(), result.end(), '\\', '/');
+		while (result.compare(0, 2, "./") == 0)
+			result.erase(0, 2);
+		return result;
+	}
+
+	inline uint64_t HashPackPath(const char* path, size_t length)
+	{
+		return HashFNV1a(path, length);
+	}
+}
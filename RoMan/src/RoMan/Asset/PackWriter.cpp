@@ -0,0 +1,151 @@
+#include "rmpch.h"
+#include "PackWriter.h"
+
+#include "RoMan/Asset/CookedFormats.h"
+
+#include <fstream>
+
+namespace RoMan
+{
+	void PackWriter::AddFile(const std::string& path, const void* data, size_t size, CompressionType compression)
+	{
+		File file;
+		file.Path = NormalizePackPath(path);
+		file.PathHash = HashPackPath(file.Path.data(), file.Path.size());
+		file.Size = size;
+
+		// Cooked textures compress their strips and pages themselves and are streamed straight from
+		// the mapped archive, compressing the whole file would make loading decompress all of it first
+		if (IsCookedTexture((const uint8_t*)data, size) || IsCookedVirtualTexture((const uint8_t*)data, size))
+			compression = CompressionType::None;
+		file.Compression = compression;
+
+		if (compression != CompressionType::None)
+			Compression::Compress(compression, data, size, file.Data);
+
+		// Less than 1/8 saved isn't worth decompressing on every load
+		if (compression == CompressionType::None || file.Data.size() > size - size / 8)
+		{
+			file.Compression = CompressionType::None;
+			file.Data.assign((const uint8_t*)data, (const uint8_t*)data + size);
+		}
+
+		auto it = m_FileIndices.find(file.Path);
+		if (it != m_FileIndices.end())
+		{
+			RM_CORE_WARN("{0} added to the pack twice, keeping the last one", file.Path);
+			m_Files[it->second] = std::move(file);
+			return;
+		}
+
+		m_FileIndices[file.Path] = m_Files.size();
+		m_Files.push_back(std::move(file));
+	}
+
+	bool PackWriter::AddFileFromDisk(const std::string& path, const std::string& diskPath, CompressionType compression)
+	{
+		std::ifstream in(diskPath, std::ios::in | std::ios::binary);
+		if (!in)
+		{
+			RM_CORE_ERROR("Couldn't open file path {0}", diskPath);
+			return false;
+		}
+
+		in.seekg(0, std::ios::end);
+		std::vector<uint8_t> data((size_t)in.tellg());
+		in.seekg(0, std::ios::beg);
+		in.read((char*)data.data(), data.size());
+
+		AddFile(path, data.data(), data.size(), compression);
+		return true;
+	}
+
+	bool PackWriter::Write(const std::string& filepath, uint32_t alignment) const
+	{
+		RM_CORE_ASSERT(alignment && alignment <= 4096 && (alignment & (alignment - 1)) == 0, "Pack alignment must be a power of two up to 4096!");
+		alignment = std::max<uint32_t>(alignment, alignof(PackEntry));
+
+		std::ofstream out(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out)
+		{
+			RM_CORE_ERROR("Couldn't open file path {0}", filepath);
+			return false;
+		}
+
+		std::vector<const File*> sorted;
+		sorted.reserve(m_Files.size());
+		for (const File& file : m_Files)
+			sorted.push_back(&file);
+		std::sort(sorted.begin(), sorted.end(), [](const File* a, const File* b)
+		{
+			return a->PathHash != b->PathHash ? a->PathHash < b->PathHash : a->Path < b->Path;
+		});
+
+		auto alignUp = [alignment](uint64_t offset) { return (offset + alignment - 1) & ~(uint64_t)(alignment - 1); };
+		static const char padding[4096] = {};
+
+		PackHeader header;
+		header.EntryCount = (uint32_t)sorted.size();
+		header.Alignment = alignment;
+
+		std::vector<PackEntry> entries(sorted.size());
+		std::string strings;
+
+		out.write((const char*)&header, sizeof(header));
+		uint64_t offset = sizeof(header);
+		for (size_t i = 0; i < sorted.size(); i++)
+		{
+			const File& file = *sorted[i];
+
+			uint64_t aligned = alignUp(offset);
+			out.write(padding, aligned - offset);
+			out.write((const char*)file.Data.data(), file.Data.size());
+
+			PackEntry& entry = entries[i];
+			entry.PathHash = file.PathHash;
+			entry.Offset = aligned;
+			entry.Size = file.Size;
+			entry.StoredSize = file.Data.size();
+			entry.PathOffset = (uint32_t)strings.size();
+			entry.PathLength = (uint32_t)file.Path.size();
+			entry.Compression = (uint32_t)file.Compression;
+
+			strings += file.Path;
+			offset = aligned + file.Data.size();
+		}
+
+		header.EntriesOffset = alignUp(offset);
+		out.write(padding, header.EntriesOffset - offset);
+		out.write((const char*)entries.data(), entries.size() * sizeof(PackEntry));
+
+		header.StringsOffset = header.EntriesOffset + entries.size() * sizeof(PackEntry);
+		header.StringsSize = strings.size();
+		out.write(strings.data(), strings.size());
+
+		out.seekp(0);
+		out.write((const char*)&header, sizeof(header));
+
+		if (!out)
+		{
+			RM_CORE_ERROR("Failed writing pack {0}", filepath);
+			return false;
+		}
+		return true;
+	}
+
+	uint64_t PackWriter::GetTotalSize() const
+	{
+		uint64_t total = 0;
+		for (const File& file : m_Files)
+			total += file.Size;
+		return total;
+	}
+
+	uint64_t PackWriter::GetTotalStoredSize() const
+	{
+		uint64_t total = 0;
+		for (const File& file : m_Files)
+			total += file.Data.size();
+		return total;
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "RoMan/Asset/PackFormat.h"
+#include "RoMan/Core/Compression.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace RoMan
+{
+	// Builds .rmpak archives, used by the packer tool. Files are compressed as they are added and
+	// stored raw when compression doesn't pay off (e.g. PNGs) or they are cooked textures, which
+	// compress their own strips and are streamed from the archive.
+	class PackWriter
+	{
+	public:
+		// Adding a path twice replaces the earlier file
+		void AddFile(const std::string& path, const void* data, size_t size, CompressionType compression = CompressionType::LZ4);
+		bool AddFileFromDisk(const std::string& path, const std::string& diskPath, CompressionType compression = CompressionType::LZ4);
+
+		// alignment must be a power of two, at most 4096
+		bool Write(const std::string& filepath, uint32_t alignment = 16) const;
+
+		uint32_t GetFileCount() const { return (uint32_t)m_Files.size(); }
+		uint64_t GetTotalSize() const;
+		uint64_t GetTotalStoredSize() const;
+
+	private:
+		struct File
+		{
+			std::string Path;
+			uint64_t PathHash;
+			uint64_t Size;
+			CompressionType Compression;
+			std::vector<uint8_t> Data;
+		};
+
+		std::vector<File> m_Files;
+		std::unordered_map<std::string, size_t> m_FileIndices;
+	};
+}
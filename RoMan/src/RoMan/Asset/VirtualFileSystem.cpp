@@ -0,0 +1,186 @@
+#include "rmpch.h"
+#include "VirtualFileSystem.h"
+
+#include "RoMan/Asset/PackFile.h"
+#include "RoMan/Core/Compression.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+#include <fstream>
+
+namespace RoMan
+{
+	struct VirtualFileSystemData
+	{
+		std::vector<Scope<PackFile>> Packs;
+		std::string LooseRoot;
+		bool LooseFallback = true;
+	};
+
+	static VirtualFileSystemData* s_Data = nullptr;
+
+	void VirtualFileSystem::Init()
+	{
+		RM_CORE_ASSERT(!s_Data, "VirtualFileSystem already initialized!");
+
+		RM_MEMORY_SCOPE(MemoryTag::Asset);
+		s_Data = new VirtualFileSystemData();
+	}
+
+	void VirtualFileSystem::Shutdown()
+	{
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	bool VirtualFileSystem::Mount(const std::string& packPath)
+	{
+		RM_CORE_ASSERT(s_Data, "VirtualFileSystem not initialized!");
+		RM_MEMORY_SCOPE(MemoryTag::Asset);
+
+		Scope<PackFile> pack = std::make_unique<PackFile>();
+		if (!pack->Open(packPath))
+		{
+			RM_CORE_WARN("Couldn't mount pack {0}", packPath);
+			return false;
+		}
+
+		RM_CORE_INFO("Mounted pack {0} ({1} files)", packPath, pack->GetEntryCount());
+		s_Data->Packs.push_back(std::move(pack));
+		return true;
+	}
+
+	void VirtualFileSystem::Unmount(const std::string& packPath)
+	{
+		RM_CORE_ASSERT(s_Data, "VirtualFileSystem not initialized!");
+
+		auto& packs = s_Data->Packs;
+		packs.erase(std::remove_if(packs.begin(), packs.end(),
+			[&](const Scope<PackFile>& pack) { return pack->GetPath() == packPath; }), packs.end());
+	}
+
+	void VirtualFileSystem::SetLooseRoot(const std::string& root)
+	{
+		RM_CORE_ASSERT(s_Data, "VirtualFileSystem not initialized!");
+
+		s_Data->LooseRoot = NormalizePackPath(root);
+		if (!s_Data->LooseRoot.empty() && s_Data->LooseRoot.back() != '/')
+			s_Data->LooseRoot += '/';
+	}
+
+	void VirtualFileSystem::SetLooseFallback(bool enabled)
+	{
+		RM_CORE_ASSERT(s_Data, "VirtualFileSystem not initialized!");
+		s_Data->LooseFallback = enabled;
+	}
+
+	static const PackFile* FindInPacks(const std::string& path, const PackEntry*& entry)
+	{
+		if (!s_Data)
+			return nullptr;
+
+		for (auto it = s_Data->Packs.rbegin(); it != s_Data->Packs.rend(); it++)
+		{
+			entry = (*it)->Find(path);
+			if (entry)
+				return it->get();
+		}
+		return nullptr;
+	}
+
+	// Tools use the file system without initializing it, loose files are all they get
+	static bool UseLooseFiles()
+	{
+		return !s_Data || s_Data->LooseFallback;
+	}
+
+	static std::string GetLoosePath(const std::string& path)
+	{
+		return s_Data ? s_Data->LooseRoot + path : path;
+	}
+
+	bool VirtualFileSystem::Exists(const std::string& path)
+	{
+		std::string normalized = NormalizePackPath(path);
+
+		const PackEntry* entry;
+		if (FindInPacks(normalized, entry))
+			return true;
+
+		return UseLooseFiles() && std::ifstream(GetLoosePath(normalized)).good();
+	}
+
+	FileData VirtualFileSystem::ReadFile(const std::string& path)
+	{
+		RM_MEMORY_SCOPE(MemoryTag::Asset);
+
+		std::string normalized = NormalizePackPath(path);
+		FileData file;
+
+		const PackEntry* entry;
+		if (const PackFile* pack = FindInPacks(normalized, entry))
+		{
+			file.Size = (size_t)entry->Size;
+			if ((CompressionType)entry->Compression == CompressionType::None)
+			{
+				file.Data = pack->GetStoredData(*entry);
+				file.Found = true;
+				return file;
+			}
+
+			file.Storage.resize(file.Size);
+			file.Data = file.Storage.data();
+			file.Found = pack->Read(*entry, file.Storage.data());
+			return file;
+		}
+
+		if (!UseLooseFiles())
+			return file;
+
+		std::ifstream in(GetLoosePath(normalized), std::ios::in | std::ios::binary);
+		if (!in)
+			return file;
+
+		in.seekg(0, std::ios::end);
+		file.Storage.resize((size_t)in.tellg());
+		in.seekg(0, std::ios::beg);
+		in.read((char*)file.Storage.data(), file.Storage.size());
+
+		file.Data = file.Storage.data();
+		file.Size = file.Storage.size();
+		file.Found = true;
+		return file;
+	}
+
+	FileData VirtualFileSystem::MapFile(const std::string& path)
+	{
+		std::string normalized = NormalizePackPath(path);
+
+		const PackEntry* entry;
+		if (FindInPacks(normalized, entry) || !UseLooseFiles())
+			return ReadFile(path);
+
+		RM_MEMORY_SCOPE(MemoryTag::Asset);
+
+		Scope<MappedFile> mapping = std::make_unique<MappedFile>();
+		// Missing and empty files alike, ReadFile tells them apart
+		if (!mapping->Open(GetLoosePath(normalized)))
+			return ReadFile(path);
+
+		FileData file;
+		file.Data = mapping->GetData();
+		file.Size = (size_t)mapping->GetSize();
+		file.Mapping = std::move(mapping);
+		file.Found = true;
+		return file;
+	}
+
+	bool VirtualFileSystem::ReadTextFile(const std::string& path, std::string& out)
+	{
+		FileData file = ReadFile(path);
+		if (!file)
+			return false;
+
+		out.assign((const char*)file.Data, file.Size);
+		return true;
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "RoMan/Core.h"
+#include "RoMan/Core/MappedFile.h"
+
+#include <string>
+#include <vector>
+
+namespace RoMan
+{
+	// Contents of a virtual file. Uncompressed pack entries point straight into the mapped archive,
+	// mapped loose files into Mapping, anything else is owned by Storage. Move only, Data may point
+	// into Storage or Mapping.
+	struct FileData
+	{
+		const uint8_t* Data = nullptr;
+		size_t Size = 0;
+		std::vector<uint8_t> Storage;
+		Scope<MappedFile> Mapping;
+		bool Found = false;
+
+		FileData() = default;
+		FileData(FileData&&) = default;
+		FileData& operator=(FileData&&) = default;
+		FileData(const FileData&) = delete;
+		FileData& operator=(const FileData&) = delete;
+
+		explicit operator bool() const { return Found; }
+	};
+
+	// Asset paths ("assets/textures/Foo.png") resolve against mounted packs first, most recently
+	// mounted wins, then against loose files on disk as a development fallback.
+	// Mounting isn't synchronized with reads, mount before loading from other threads.
+	class VirtualFileSystem
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		static bool Mount(const std::string& packPath);
+		static void Unmount(const std::string& packPath);
+
+		// Directory loose paths are relative to, empty for the working directory
+		static void SetLooseRoot(const std::string& root);
+		static void SetLooseFallback(bool enabled);
+
+		static bool Exists(const std::string& path);
+
+		static FileData ReadFile(const std::string& path);
+		// Like ReadFile, but loose files are memory mapped instead of read, so only the parts that are
+		// touched become resident. For large files consumed piece by piece, like cooked textures.
+		// Compressed pack entries are still decompressed whole.
+		static FileData MapFile(const std::string& path);
+		static bool ReadTextFile(const std::string& path, std::string& out);
+	};
+}
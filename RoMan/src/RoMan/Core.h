@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include "RoMan/Core/Ref.h"
+
 #ifdef RM_PLATFORM_WINDOWS
 #ifdef RM_DYNAMIC_LINK
 	#ifdef RM_BUILD_DLL
@@ -12,8 +14,13 @@
 #else
 	#define ROMAN_API
 #endif
+	#define RM_DEBUGBREAK() __debugbreak()
+#elif defined(RM_PLATFORM_LINUX)
+	#include <csignal>
+	#define ROMAN_API
+	#define RM_DEBUGBREAK() raise(SIGTRAP)
 #else
-	#error RoMan supports only Windows!
+	#error RoMan supports only Windows and Linux!
 #endif
 
 #ifdef RM_DEBUG
@@ -21,8 +28,8 @@
 #endif
 
 #ifdef RM_ENABLE_ASSERTS
-	#define RM_ASSERT(x, ...) { if(!(x)) { RM_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
-	#define RM_CORE_ASSERT(x, ...) { if(!(x)) { RM_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
+	#define RM_ASSERT(x, ...) { if(!(x)) { RM_ERROR("Assertion Failed: {0}", __VA_ARGS__); RoMan::Log::Flush(); RM_DEBUGBREAK(); } }
+	#define RM_CORE_ASSERT(x, ...) { if(!(x)) { RM_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); RoMan::Log::Flush(); RM_DEBUGBREAK(); } }
 #else
 	#define RM_ASSERT(x, ...)
 	#define RM_CORE_ASSERT(x, ...)
@@ -36,7 +43,4 @@ namespace RoMan
 {
 	template<typename T>
 	using Scope = std::unique_ptr<T>;
-
-	template<typename T>
-	using Ref = std::shared_ptr<T>;
 }
\ No newline at end of file
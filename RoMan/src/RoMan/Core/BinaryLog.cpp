@@ -0,0 +1,336 @@
+#include "rmpch.h"
+#include "BinaryLog.h"
+
+#include "RoMan/Core/MemoryTracker.h"
+
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+namespace RoMan
+{
+	struct BinaryLogFormatInfo
+	{
+		std::string Format;
+		std::string File;
+		uint32_t Line = 0;
+		std::string ArgTypes;
+	};
+
+	// Outlives Init and Shutdown, every call site registers once per process
+	struct BinaryLogFormats
+	{
+		std::mutex Mutex;
+		std::vector<BinaryLogFormatInfo> Formats;
+	};
+
+	static BinaryLogFormats& GetFormats()
+	{
+		static BinaryLogFormats formats;
+		return formats;
+	}
+
+	struct BinaryLogData
+	{
+		BinaryLogSpecification Specification;
+		std::ofstream File;
+		uint32_t Generation = 0;
+
+		std::mutex WriteMutex; // Held for a whole write pass
+		size_t WrittenFormats = 0;
+
+		std::mutex Mutex;      // Guards everything below
+		std::condition_variable Condition;
+		std::vector<std::unique_ptr<uint8_t[]>> Storage;
+		std::vector<BinaryLogThreadBuffer*> Free;
+		std::vector<BinaryLogThreadBuffer*> Live;
+		std::vector<BinaryLogThreadBuffer*> Retired;
+		std::vector<std::unique_ptr<BinaryLogThreadBuffer>> Buffers;
+		bool Stop = false;
+
+		std::atomic<uint64_t> Dropped{ 0 };
+		std::thread Writer;
+	};
+
+	static BinaryLogData* s_Data = nullptr;
+	static std::atomic<uint32_t> s_NextThreadId{ 1 };
+	static thread_local uint32_t t_ThreadId = 0;
+
+	// Hands the buffer of an exiting thread to the writer
+	struct BinaryLogThreadExit
+	{
+		~BinaryLogThreadExit();
+	};
+
+	static thread_local BinaryLogThreadExit t_ThreadExit;
+
+	static void WriteBlock(std::ofstream& file, BinaryLogBlockType type, uint32_t threadId, const uint8_t* data, uint64_t size)
+	{
+		BinaryLogBlock block;
+		block.Type = (uint32_t)type;
+		block.ThreadId = threadId;
+		block.Size = size;
+		file.write((const char*)&block, sizeof(block));
+		file.write((const char*)data, size);
+	}
+
+	static void WritePass(BinaryLogData& data)
+	{
+		std::lock_guard<std::mutex> writeLock(data.WriteMutex);
+
+		std::vector<BinaryLogThreadBuffer*> retired;
+		std::vector<std::pair<BinaryLogThreadBuffer*, uint32_t>> live;
+		{
+			std::lock_guard<std::mutex> lock(data.Mutex);
+			retired.swap(data.Retired);
+			for (BinaryLogThreadBuffer* buffer : data.Live)
+				live.emplace_back(buffer, buffer->Committed.load(std::memory_order_acquire));
+		}
+
+		// Records committed above were registered before, so their formats are in this snapshot
+		std::vector<uint8_t> formatBlock;
+		{
+			BinaryLogFormats& formats = GetFormats();
+			std::lock_guard<std::mutex> lock(formats.Mutex);
+			for (; data.WrittenFormats < formats.Formats.size(); data.WrittenFormats++)
+			{
+				const BinaryLogFormatInfo& info = formats.Formats[data.WrittenFormats];
+
+				BinaryLogFormatEntry entry;
+				entry.Id = (uint32_t)data.WrittenFormats;
+				entry.Line = info.Line;
+				entry.ArgCount = (uint16_t)info.ArgTypes.size();
+				entry.FormatLength = (uint16_t)info.Format.size();
+				entry.FileLength = (uint16_t)info.File.size();
+
+				const uint8_t* bytes = (const uint8_t*)&entry;
+				formatBlock.insert(formatBlock.end(), bytes, bytes + sizeof(entry));
+				formatBlock.insert(formatBlock.end(), info.ArgTypes.begin(), info.ArgTypes.end());
+				formatBlock.insert(formatBlock.end(), info.Format.begin(), info.Format.begin() + entry.FormatLength);
+				formatBlock.insert(formatBlock.end(), info.File.begin(), info.File.begin() + entry.FileLength);
+			}
+		}
+
+		if (!formatBlock.empty())
+			WriteBlock(data.File, BinaryLogBlockType::Formats, 0, formatBlock.data(), formatBlock.size());
+
+		// Owners no longer touch retired buffers
+		for (BinaryLogThreadBuffer* buffer : retired)
+		{
+			uint32_t committed = buffer->Committed.load(std::memory_order_acquire);
+			if (committed > buffer->Written)
+				WriteBlock(data.File, BinaryLogBlockType::Records, buffer->ThreadId, buffer->Data + buffer->Written, committed - buffer->Written);
+
+			buffer->Written = 0;
+			buffer->Committed.store(0, std::memory_order_relaxed);
+		}
+
+		for (auto& [buffer, committed] : live)
+		{
+			if (committed > buffer->Written)
+				WriteBlock(data.File, BinaryLogBlockType::Records, buffer->ThreadId, buffer->Data + buffer->Written, committed - buffer->Written);
+			buffer->Written = committed;
+		}
+
+		data.File.flush();
+
+		if (!retired.empty())
+		{
+			std::lock_guard<std::mutex> lock(data.Mutex);
+			data.Free.insert(data.Free.end(), retired.begin(), retired.end());
+		}
+	}
+
+	static void WriterLoop(BinaryLogData& data)
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(data.Mutex);
+				data.Condition.wait_for(lock, std::chrono::milliseconds(data.Specification.FlushInterval),
+					[&]() { return data.Stop || !data.Retired.empty(); });
+				if (data.Stop)
+					return;
+			}
+
+			WritePass(data);
+		}
+	}
+
+	static void RetireBuffer(BinaryLogData& data, BinaryLogThreadBuffer* buffer)
+	{
+		auto it = std::find(data.Live.begin(), data.Live.end(), buffer);
+		if (it != data.Live.end())
+		{
+			*it = data.Live.back();
+			data.Live.pop_back();
+		}
+		data.Retired.push_back(buffer);
+	}
+
+	BinaryLogThreadExit::~BinaryLogThreadExit()
+	{
+		BinaryLog::ReleaseBuffer();
+	}
+
+	bool BinaryLog::Init(const std::string& filepath, const BinaryLogSpecification& specification)
+	{
+		RM_CORE_ASSERT(!s_Data, "BinaryLog already initialized");
+		RM_MEMORY_SCOPE(MemoryTag::Core);
+
+		std::error_code error;
+		std::filesystem::path path(filepath);
+		if (path.has_parent_path())
+			std::filesystem::create_directories(path.parent_path(), error);
+
+		std::ofstream file(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			RM_CORE_ERROR("Could not open binary log {0}", filepath);
+			return false;
+		}
+
+		BinaryLogHeader header;
+		header.StartTimestamp = (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+		header.StartTime = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+		file.write((const char*)&header, sizeof(header));
+
+		s_Data = new BinaryLogData();
+		s_Data->Specification = specification;
+		s_Data->Specification.BufferSize = std::max(specification.BufferSize, 4096u);
+		s_Data->Specification.MaxBuffers = std::max(specification.MaxBuffers, 1u);
+		s_Data->File = std::move(file);
+		s_Data->Generation = s_Generation.fetch_add(1, std::memory_order_relaxed) + 1;
+		s_Data->Writer = std::thread(WriterLoop, std::ref(*s_Data));
+
+		return true;
+	}
+
+	void BinaryLog::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->Mutex);
+			s_Data->Stop = true;
+		}
+		s_Data->Condition.notify_one();
+		s_Data->Writer.join();
+
+		s_Generation.fetch_add(1, std::memory_order_relaxed);
+		WritePass(*s_Data);
+
+		uint64_t dropped = s_Data->Dropped.load(std::memory_order_relaxed);
+		if (dropped > 0)
+			RM_CORE_WARN("Binary log dropped {0} records, raise BufferSize or MaxBuffers", dropped);
+
+		delete s_Data;
+		s_Data = nullptr;
+		t_Buffer = nullptr;
+	}
+
+	void BinaryLog::Flush()
+	{
+		if (s_Data)
+			WritePass(*s_Data);
+	}
+
+	uint64_t BinaryLog::GetDroppedRecords()
+	{
+		return s_Data ? s_Data->Dropped.load(std::memory_order_relaxed) : 0;
+	}
+
+	uint32_t BinaryLog::RegisterFormat(const char* format, const char* file, uint32_t line, const char* argTypes)
+	{
+		BinaryLogFormats& formats = GetFormats();
+		std::lock_guard<std::mutex> lock(formats.Mutex);
+
+		BinaryLogFormatInfo& info = formats.Formats.emplace_back();
+		info.Format = format;
+		info.File = file;
+		info.Line = line;
+		info.ArgTypes = argTypes;
+
+		// Lengths are stored in 16 bits
+		if (info.Format.size() > UINT16_MAX)
+			info.Format.resize(UINT16_MAX);
+		if (info.File.size() > UINT16_MAX)
+			info.File.erase(0, info.File.size() - UINT16_MAX);
+
+		return (uint32_t)formats.Formats.size() - 1;
+	}
+
+	void BinaryLog::ReleaseBuffer()
+	{
+		BinaryLogData* data = s_Data;
+		if (!data)
+			return;
+
+		std::lock_guard<std::mutex> lock(data->Mutex);
+		if (t_Buffer && t_Generation == data->Generation)
+		{
+			RetireBuffer(*data, t_Buffer);
+			data->Condition.notify_one();
+		}
+		t_Buffer = nullptr;
+	}
+
+	BinaryLogThreadBuffer* BinaryLog::AcquireBuffer(size_t size)
+	{
+		BinaryLogData* data = s_Data;
+		if (!data)
+			return nullptr;
+
+		if (size > data->Specification.BufferSize)
+		{
+			data->Dropped.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock(data->Mutex);
+
+		if (t_Buffer && t_Generation == data->Generation)
+		{
+			RetireBuffer(*data, t_Buffer);
+			data->Condition.notify_one();
+		}
+		t_Buffer = nullptr;
+		t_Generation = data->Generation;
+
+		BinaryLogThreadBuffer* buffer = nullptr;
+		if (!data->Free.empty())
+		{
+			buffer = data->Free.back();
+			data->Free.pop_back();
+		}
+		else if (data->Buffers.size() < data->Specification.MaxBuffers)
+		{
+			RM_MEMORY_SCOPE(MemoryTag::Core);
+			data->Storage.push_back(std::make_unique<uint8_t[]>(data->Specification.BufferSize));
+			data->Buffers.push_back(std::make_unique<BinaryLogThreadBuffer>());
+			buffer = data->Buffers.back().get();
+			buffer->Data = data->Storage.back().get();
+			buffer->Capacity = data->Specification.BufferSize;
+		}
+		else
+		{
+			data->Dropped.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		// Touching the exit guard registers its destructor for this thread
+		if (t_ThreadId == 0)
+		{
+			t_ThreadId = s_NextThreadId.fetch_add(1, std::memory_order_relaxed);
+			(void)&t_ThreadExit;
+		}
+
+		buffer->ThreadId = t_ThreadId;
+		data->Live.push_back(buffer);
+		t_Buffer = buffer;
+		return buffer;
+	}
+}
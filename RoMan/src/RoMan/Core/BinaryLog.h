@@ -0,0 +1,109 @@
+#pragma once
+
+#include "RoMan/Core.h"
+#include "RoMan/Core/BinaryLogFormat.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace RoMan
+{
+	struct BinaryLogSpecification
+	{
+		// Per thread buffer, records larger than this are dropped
+		uint32_t BufferSize = 64 * 1024;
+		// Buffers shared by all threads. When every one is full and not yet written, records are dropped.
+		uint32_t MaxBuffers = 64;
+		// Milliseconds between writes of the buffers to the file
+		uint32_t FlushInterval = 100;
+	};
+
+	struct BinaryLogThreadBuffer
+	{
+		uint8_t* Data = nullptr;
+		uint32_t Capacity = 0;
+		std::atomic<uint32_t> Committed{ 0 };
+		uint32_t Written = 0; // Writer thread only
+		uint32_t ThreadId = 0;
+	};
+
+	// Structured binary log for high volume tracing, next to the text Log. RM_BINLOG registers its
+	// format string once per call site, after that a call only copies a format id, a timestamp and the
+	// raw argument bytes into a buffer owned by the calling thread. A background thread writes filled
+	// buffers to a .rmlog file, which RoManLog renders to text offline.
+	//
+	//   RM_BINLOG("Entity {0} moved to {1:.2f}, {2:.2f}", entity, x, y);
+	//
+	// Arguments are numbers, bools, pointers and strings, formatted like the Log macros. Until Init,
+	// which the entry point only calls for --binlog <file>, records are dropped right away.
+	class BinaryLog
+	{
+	public:
+		static bool Init(const std::string& filepath, const BinaryLogSpecification& specification = {});
+		// Writes out every thread's records, only call once no other thread logs anymore
+		static void Shutdown();
+
+		// Writes out what every thread has logged so far
+		static void Flush();
+
+		// Records lost to full buffers since Init
+		static uint64_t GetDroppedRecords();
+
+		static uint32_t RegisterFormat(const char* format, const char* file, uint32_t line, const char* argTypes);
+
+		template<typename... Args>
+		static BinaryLogArgTypes<Args...> GetArgTypes(const Args&...);
+
+		template<typename... Args>
+		static void Write(uint32_t formatId, const Args&... args)
+		{
+			size_t size = sizeof(BinaryLogRecord) + (BinaryLogArg<std::decay_t<Args>>::GetSize(args) + ... + 0);
+
+			BinaryLogThreadBuffer* buffer = t_Buffer;
+			uint32_t offset = 0;
+			if (!buffer || t_Generation != s_Generation.load(std::memory_order_relaxed) ||
+				buffer->Capacity - (offset = buffer->Committed.load(std::memory_order_relaxed)) < size)
+			{
+				buffer = AcquireBuffer(size);
+				if (!buffer)
+					return;
+				offset = 0;
+			}
+
+			BinaryLogRecord record;
+			record.FormatId = formatId;
+			record.Size = (uint32_t)size;
+			record.Timestamp = (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+
+			uint8_t* out = buffer->Data + offset;
+			memcpy(out, &record, sizeof(record));
+			out += sizeof(record);
+			((out = BinaryLogArg<std::decay_t<Args>>::Write(out, args)), ...);
+
+			// The writer thread only reads up to Committed
+			buffer->Committed.store(offset + (uint32_t)size, std::memory_order_release);
+		}
+
+	private:
+		// Retires the thread's buffer and hands it a fresh one, nullptr drops the record
+		static BinaryLogThreadBuffer* AcquireBuffer(size_t size);
+		// Retires the thread's buffer when the thread exits
+		static void ReleaseBuffer();
+
+		friend struct BinaryLogThreadExit;
+
+		// Bumped by Init and Shutdown, so threads drop buffers of an earlier session
+		static inline std::atomic<uint32_t> s_Generation{ 0 };
+		static inline thread_local BinaryLogThreadBuffer* t_Buffer = nullptr;
+		static inline thread_local uint32_t t_Generation = 0;
+	};
+}
+
+#define RM_BINLOG(format, ...) \
+	do \
+	{ \
+		using RMBinaryLogArgTypes = decltype(::RoMan::BinaryLog::GetArgTypes(__VA_ARGS__)); \
+		static const uint32_t rmBinaryLogFormat = ::RoMan::BinaryLog::RegisterFormat(format, __FILE__, __LINE__, RMBinaryLogArgTypes::Value); \
+		::RoMan::BinaryLog::Write(rmBinaryLogFormat, ##__VA_ARGS__); \
+	} while (0)
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace RoMan
+{
+	// Layout of a .rmlog file, little endian:
+	//   BinaryLogHeader
+	//   blocks, each a BinaryLogBlock followed by Size bytes:
+	//     Formats: BinaryLogFormatEntry, then ArgCount type codes, the format and the file name
+	//     Records: one thread's BinaryLogRecords in the order they were logged
+	// A format block always comes before the first record that uses it. Records of different threads
+	// interleave by block, decoders sort them by Timestamp.
+	static constexpr uint32_t BinaryLogMagic = 0x4C424D52; // "RMBL"
+	static constexpr uint32_t BinaryLogVersion = 1;
+
+	struct BinaryLogHeader
+	{
+		uint32_t Magic = BinaryLogMagic;
+		uint32_t Version = BinaryLogVersion;
+		uint64_t StartTimestamp = 0; // Steady clock, ns, records are relative to this
+		int64_t StartTime = 0;       // System clock at StartTimestamp, ns since the epoch
+	};
+
+	enum class BinaryLogBlockType : uint32_t
+	{
+		Formats = 0, Records
+	};
+
+	struct BinaryLogBlock
+	{
+		uint32_t Type = 0;     // BinaryLogBlockType
+		uint32_t ThreadId = 0; // Records only
+		uint64_t Size = 0;
+	};
+
+	struct BinaryLogFormatEntry
+	{
+		uint32_t Id = 0;
+		uint32_t Line = 0;
+		uint16_t ArgCount = 0;
+		uint16_t FormatLength = 0;
+		uint16_t FileLength = 0;
+		uint16_t Reserved = 0;
+	};
+
+	// Followed by the arguments, packed without padding
+	struct BinaryLogRecord
+	{
+		uint32_t FormatId = 0;
+		uint32_t Size = 0; // Including this header
+		uint64_t Timestamp = 0;
+	};
+
+	static_assert(sizeof(BinaryLogHeader) == 24, "BinaryLogHeader layout changed");
+	static_assert(sizeof(BinaryLogBlock) == 16, "BinaryLogBlock layout changed");
+	static_assert(sizeof(BinaryLogFormatEntry) == 16, "BinaryLogFormatEntry layout changed");
+	static_assert(sizeof(BinaryLogRecord) == 16, "BinaryLogRecord layout changed");
+
+	// Argument type codes: c s i l signed and C S I L unsigned 8 to 64 bit integers, b bool, f float,
+	// d double, p pointer as 64 bits, t text as a 16 bit length and the characters
+	static constexpr size_t BinaryLogMaxTextLength = 1024;
+
+	template<typename T, typename = void>
+	struct BinaryLogArg
+	{
+		static_assert(sizeof(T) == 0, "Unsupported RM_BINLOG argument type, log numbers, pointers or strings");
+	};
+
+	template<typename T>
+	struct BinaryLogArg<T, std::enable_if_t<(std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>>>
+	{
+		static constexpr char Type = std::is_signed_v<T> ?
+			(sizeof(T) == 1 ? 'c' : sizeof(T) == 2 ? 's' : sizeof(T) == 4 ? 'i' : 'l') :
+			(sizeof(T) == 1 ? 'C' : sizeof(T) == 2 ? 'S' : sizeof(T) == 4 ? 'I' : 'L');
+
+		static size_t GetSize(const T&) { return sizeof(T); }
+		static uint8_t* Write(uint8_t* out, const T& value) { memcpy(out, &value, sizeof(T)); return out + sizeof(T); }
+	};
+
+	template<>
+	struct BinaryLogArg<bool>
+	{
+		static constexpr char Type = 'b';
+		static size_t GetSize(bool) { return 1; }
+		static uint8_t* Write(uint8_t* out, bool value) { *out = value ? 1 : 0; return out + 1; }
+	};
+
+	template<>
+	struct BinaryLogArg<float>
+	{
+		static constexpr char Type = 'f';
+		static size_t GetSize(float) { return sizeof(float); }
+		static uint8_t* Write(uint8_t* out, float value) { memcpy(out, &value, sizeof(float)); return out + sizeof(float); }
+	};
+
+	template<>
+	struct BinaryLogArg<double>
+	{
+		static constexpr char Type = 'd';
+		static size_t GetSize(double) { return sizeof(double); }
+		static uint8_t* Write(uint8_t* out, double value) { memcpy(out, &value, sizeof(double)); return out + sizeof(double); }
+	};
+
+	template<>
+	struct BinaryLogArg<std::string_view>
+	{
+		static constexpr char Type = 't';
+
+		static size_t GetSize(std::string_view value) { return sizeof(uint16_t) + std::min(value.size(), BinaryLogMaxTextLength); }
+		static uint8_t* Write(uint8_t* out, std::string_view value)
+		{
+			uint16_t length = (uint16_t)std::min(value.size(), BinaryLogMaxTextLength);
+			memcpy(out, &length, sizeof(length));
+			memcpy(out + sizeof(length), value.data(), length);
+			return out + sizeof(length) + length;
+		}
+	};
+
+	template<>
+	struct BinaryLogArg<std::string> : BinaryLogArg<std::string_view> {};
+
+	template<>
+	struct BinaryLogArg<const char*>
+	{
+		static constexpr char Type = 't';
+		static size_t GetSize(const char* value) { return BinaryLogArg<std::string_view>::GetSize(value ? value : ""); }
+		static uint8_t* Write(uint8_t* out, const char* value) { return BinaryLogArg<std::string_view>::Write(out, value ? value : ""); }
+	};
+
+	template<>
+	struct BinaryLogArg<char*> : BinaryLogArg<const char*> {};
+
+	template<typename T>
+	struct BinaryLogArg<T*, std::enable_if_t<!std::is_same_v<std::remove_cv_t<T>, char>>>
+	{
+		static constexpr char Type = 'p';
+		static size_t GetSize(const T*) { return sizeof(uint64_t); }
+		static uint8_t* Write(uint8_t* out, const T* value) { uint64_t address = (uint64_t)(uintptr_t)value; memcpy(out, &address, sizeof(address)); return out + sizeof(address); }
+	};
+
+	template<typename... Args>
+	struct BinaryLogArgTypes
+	{
+		static constexpr char Value[] = { BinaryLogArg<std::decay_t<Args>>::Type..., '\0' };
+	};
+}
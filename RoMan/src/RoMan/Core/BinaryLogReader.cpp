@@ -0,0 +1,301 @@
+#include "rmpch.h"
+#include "BinaryLogReader.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+
+namespace RoMan
+{
+	struct BinaryLogValue
+	{
+		char Type = 0;
+		int64_t Int = 0;
+		uint64_t UInt = 0;
+		double Double = 0.0;
+		std::string_view Text;
+	};
+
+	template<typename T>
+	static bool ReadValue(const uint8_t*& data, const uint8_t* end, T& value)
+	{
+		if ((size_t)(end - data) < sizeof(T))
+			return false;
+		memcpy(&value, data, sizeof(T));
+		data += sizeof(T);
+		return true;
+	}
+
+	static bool ReadArg(char type, const uint8_t*& data, const uint8_t* end, BinaryLogValue& value)
+	{
+		value.Type = type;
+		switch (type)
+		{
+			case 'c': { int8_t v; if (!ReadValue(data, end, v)) return false; value.Int = v; return true; }
+			case 's': { int16_t v; if (!ReadValue(data, end, v)) return false; value.Int = v; return true; }
+			case 'i': { int32_t v; if (!ReadValue(data, end, v)) return false; value.Int = v; return true; }
+			case 'l': { int64_t v; if (!ReadValue(data, end, v)) return false; value.Int = v; return true; }
+			case 'C': { uint8_t v; if (!ReadValue(data, end, v)) return false; value.UInt = v; return true; }
+			case 'S': { uint16_t v; if (!ReadValue(data, end, v)) return false; value.UInt = v; return true; }
+			case 'I': { uint32_t v; if (!ReadValue(data, end, v)) return false; value.UInt = v; return true; }
+			case 'L': case 'p': { uint64_t v; if (!ReadValue(data, end, v)) return false; value.UInt = v; return true; }
+			case 'b': { uint8_t v; if (!ReadValue(data, end, v)) return false; value.UInt = v; return true; }
+			case 'f': { float v; if (!ReadValue(data, end, v)) return false; value.Double = v; return true; }
+			case 'd': { double v; if (!ReadValue(data, end, v)) return false; value.Double = v; return true; }
+			case 't':
+			{
+				uint16_t length;
+				if (!ReadValue(data, end, length) || (size_t)(end - data) < length)
+					return false;
+				value.Text = std::string_view((const char*)data, length);
+				data += length;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static std::string FormatValue(const std::string& pattern, const BinaryLogValue& value)
+	{
+		switch (value.Type)
+		{
+			case 'c': case 's': case 'i': case 'l':
+			{
+				int64_t v = value.Int;
+				return fmt::vformat(pattern, fmt::make_format_args(v));
+			}
+			case 'C': case 'S': case 'I': case 'L':
+			{
+				uint64_t v = value.UInt;
+				return fmt::vformat(pattern, fmt::make_format_args(v));
+			}
+			case 'p':
+			{
+				uint64_t v = value.UInt;
+				return fmt::vformat(pattern == "{}" ? "{:#x}" : pattern, fmt::make_format_args(v));
+			}
+			case 'b':
+			{
+				bool v = value.UInt != 0;
+				return fmt::vformat(pattern, fmt::make_format_args(v));
+			}
+			case 'f': case 'd':
+			{
+				double v = value.Double;
+				return fmt::vformat(pattern, fmt::make_format_args(v));
+			}
+			case 't':
+			{
+				std::string_view v = value.Text;
+				return fmt::vformat(pattern, fmt::make_format_args(v));
+			}
+		}
+		return "?";
+	}
+
+	// An index that isn't a number or has no argument returns count, so the placeholder is kept as text
+	static size_t ParseArgIndex(const std::string& index, size_t count)
+	{
+		if (index.find_first_not_of("0123456789") != std::string::npos)
+			return count;
+
+		errno = 0;
+		char* end = nullptr;
+		unsigned long long value = strtoull(index.c_str(), &end, 10);
+		if (errno == ERANGE || *end != '\0' || value >= count)
+			return count;
+		return (size_t)value;
+	}
+
+	bool BinaryLogReader::FormatMessage(const std::string& format, const std::string& argTypes, const uint8_t* args, size_t size, std::string& out)
+	{
+		std::vector<BinaryLogValue> values(argTypes.size());
+		const uint8_t* data = args;
+		for (size_t i = 0; i < argTypes.size(); i++)
+		{
+			if (!ReadArg(argTypes[i], data, args + size, values[i]))
+				return false;
+		}
+
+		out.clear();
+		size_t nextIndex = 0;
+		for (size_t i = 0; i < format.size(); i++)
+		{
+			char c = format[i];
+			if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c)
+			{
+				out += c;
+				i++;
+				continue;
+			}
+
+			size_t close = c == '{' ? format.find('}', i) : std::string::npos;
+			if (close == std::string::npos)
+			{
+				out += c;
+				continue;
+			}
+
+			// {N:spec} renders values[N] with "{:spec}", a missing N takes the next argument
+			std::string placeholder = format.substr(i + 1, close - i - 1);
+			size_t colon = placeholder.find(':');
+			std::string index = placeholder.substr(0, colon);
+			std::string pattern = colon == std::string::npos ? "{}" : "{" + placeholder.substr(colon) + "}";
+
+			size_t argIndex = nextIndex++;
+			if (!index.empty())
+				argIndex = ParseArgIndex(index, values.size());
+
+			if (argIndex < values.size())
+			{
+				try
+				{
+					out += FormatValue(pattern, values[argIndex]);
+				}
+				catch (const fmt::format_error&)
+				{
+					out += format.substr(i, close - i + 1);
+				}
+			}
+			else
+			{
+				out += format.substr(i, close - i + 1);
+			}
+
+			i = close;
+		}
+
+		return true;
+	}
+
+	bool BinaryLogReader::Open(const std::string& filepath)
+	{
+		m_Formats.clear();
+		m_Messages.clear();
+
+		std::ifstream in(filepath, std::ios::in | std::ios::binary);
+		if (!in)
+		{
+			RM_CORE_ERROR("Could not open binary log {0}", filepath);
+			return false;
+		}
+
+		std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		if (file.size() < sizeof(BinaryLogHeader))
+		{
+			RM_CORE_ERROR("{0} is not a binary log", filepath);
+			return false;
+		}
+
+		memcpy(&m_Header, file.data(), sizeof(m_Header));
+		if (m_Header.Magic != BinaryLogMagic || m_Header.Version != BinaryLogVersion)
+		{
+			RM_CORE_ERROR("{0} has an unknown magic or version {1}", filepath, m_Header.Version);
+			return false;
+		}
+
+		size_t offset = sizeof(BinaryLogHeader);
+		while (offset < file.size())
+		{
+			BinaryLogBlock block;
+			if (file.size() - offset < sizeof(block))
+			{
+				RM_CORE_WARN("{0} is truncated, decoded up to byte {1}", filepath, offset);
+				break;
+			}
+
+			memcpy(&block, file.data() + offset, sizeof(block));
+			offset += sizeof(block);
+			if (file.size() - offset < block.Size)
+			{
+				RM_CORE_WARN("{0} is truncated, decoded up to byte {1}", filepath, offset - sizeof(block));
+				break;
+			}
+
+			const uint8_t* data = file.data() + offset;
+			bool valid = false;
+			if (block.Type == (uint32_t)BinaryLogBlockType::Formats)
+				valid = ReadFormats(data, block.Size, file.size() / sizeof(BinaryLogFormatEntry));
+			else if (block.Type == (uint32_t)BinaryLogBlockType::Records)
+				valid = ReadRecords(block.ThreadId, data, block.Size);
+
+			if (!valid)
+			{
+				RM_CORE_ERROR("{0} has an invalid block at byte {1}", filepath, offset - sizeof(block));
+				return false;
+			}
+
+			offset += block.Size;
+		}
+
+		// Each thread's records are already in order
+		std::stable_sort(m_Messages.begin(), m_Messages.end(), [](const BinaryLogMessage& a, const BinaryLogMessage& b) { return a.Time < b.Time; });
+		return true;
+	}
+
+	bool BinaryLogReader::ReadFormats(const uint8_t* data, size_t size, size_t maxFormats)
+	{
+		size_t offset = 0;
+		while (offset < size)
+		{
+			BinaryLogFormatEntry entry;
+			if (size - offset < sizeof(entry))
+				return false;
+			memcpy(&entry, data + offset, sizeof(entry));
+			offset += sizeof(entry);
+
+			size_t length = (size_t)entry.ArgCount + entry.FormatLength + entry.FileLength;
+			if (size - offset < length)
+				return false;
+
+			// Ids are handed out in order and every format takes an entry in the file, so a larger
+			// id is corrupt and would otherwise size m_Formats from garbage
+			if (entry.Id >= maxFormats)
+				return false;
+
+			if (m_Formats.size() <= entry.Id)
+				m_Formats.resize((size_t)entry.Id + 1);
+
+			FormatInfo& format = m_Formats[entry.Id];
+			const char* text = (const char*)data + offset;
+			format.ArgTypes.assign(text, entry.ArgCount);
+			format.Format.assign(text + entry.ArgCount, entry.FormatLength);
+			format.File.assign(text + entry.ArgCount + entry.FormatLength, entry.FileLength);
+			format.Line = entry.Line;
+			format.Valid = true;
+
+			offset += length;
+		}
+		return true;
+	}
+
+	bool BinaryLogReader::ReadRecords(uint32_t threadId, const uint8_t* data, size_t size)
+	{
+		size_t offset = 0;
+		while (offset < size)
+		{
+			BinaryLogRecord record;
+			if (size - offset < sizeof(record))
+				return false;
+			memcpy(&record, data + offset, sizeof(record));
+			if (record.Size < sizeof(record) || size - offset < record.Size)
+				return false;
+
+			if (record.FormatId >= m_Formats.size() || !m_Formats[record.FormatId].Valid)
+				return false;
+
+			BinaryLogMessage& message = m_Messages.emplace_back();
+			message.Time = record.Timestamp - m_Header.StartTimestamp;
+			message.ThreadId = threadId;
+			message.FormatId = record.FormatId;
+
+			const FormatInfo& format = m_Formats[record.FormatId];
+			const uint8_t* args = data + offset + sizeof(record);
+			if (!FormatMessage(format.Format, format.ArgTypes, args, record.Size - sizeof(record), message.Text))
+				message.Text = "<corrupt record> " + format.Format;
+
+			offset += record.Size;
+		}
+		return true;
+	}
+}
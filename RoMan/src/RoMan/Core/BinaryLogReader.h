@@ -0,0 +1,53 @@
+#pragma once
+
+#include "RoMan/Core/BinaryLogFormat.h"
+
+#include <string>
+#include <vector>
+
+namespace RoMan
+{
+	struct BinaryLogMessage
+	{
+		uint64_t Time = 0; // ns since the log started
+		uint32_t ThreadId = 0;
+		uint32_t FormatId = 0;
+		std::string Text;
+	};
+
+	// Decodes a .rmlog written by BinaryLog. A file cut short by a crash decodes up to its last
+	// complete block.
+	class BinaryLogReader
+	{
+	public:
+		bool Open(const std::string& filepath);
+
+		const BinaryLogHeader& GetHeader() const { return m_Header; }
+		// Every record, ordered by time
+		const std::vector<BinaryLogMessage>& GetMessages() const { return m_Messages; }
+
+		const std::string& GetFile(uint32_t formatId) const { return m_Formats[formatId].File; }
+		uint32_t GetLine(uint32_t formatId) const { return m_Formats[formatId].Line; }
+
+		// Renders format with the packed args, placeholders are {}, {N} and {N:spec} as in fmt
+		static bool FormatMessage(const std::string& format, const std::string& argTypes, const uint8_t* args, size_t size, std::string& out);
+
+	private:
+		struct FormatInfo
+		{
+			std::string Format;
+			std::string File;
+			std::string ArgTypes;
+			uint32_t Line = 0;
+			bool Valid = false;
+		};
+
+		bool ReadFormats(const uint8_t* data, size_t size, size_t maxFormats);
+		bool ReadRecords(uint32_t threadId, const uint8_t* data, size_t size);
+
+	private:
+		BinaryLogHeader m_Header;
+		std::vector<FormatInfo> m_Formats;
+		std::vector<BinaryLogMessage> m_Messages;
+	};
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+
+namespace RoMan
+{
+	namespace CommandLine
+	{
+		// Parses a whole argument as an unsigned 32-bit number, false on anything else
+		inline bool ParseUInt32(const char* text, uint32_t& value)
+		{
+			if (!text || *text < '0' || *text > '9')
+				return false;
+
+			char* end = nullptr;
+			errno = 0;
+			unsigned long long parsed = std::strtoull(text, &end, 10);
+			if (errno != 0 || *end != '\0' || parsed > UINT32_MAX)
+				return false;
+
+			value = (uint32_t)parsed;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,244 @@
+#include "rmpch.h"
+#include "Compression.h"
+
+#include <cstring>
+
+namespace RoMan
+{
+	namespace LZ4
+	{
+		static constexpr uint32_t MinMatch = 4;
+		static constexpr uint32_t LastLiterals = 5;    // The block always ends with this many literals
+		static constexpr uint32_t MatchFindLimit = 12; // No match may start closer than this to the end
+		static constexpr uint32_t MaxOffset = 65535;
+		static constexpr uint32_t HashBits = 12;
+
+		static uint32_t Read32(const uint8_t* p)
+		{
+			uint32_t value;
+			memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		static uint32_t Hash(uint32_t sequence)
+		{
+			return (sequence * 2654435761u) >> (32 - HashBits);
+		}
+
+		static uint8_t* WriteLength(uint8_t* op, size_t length)
+		{
+			for (; length >= 255; length -= 255)
+				*op++ = 255;
+			*op++ = (uint8_t)length;
+			return op;
+		}
+
+		static size_t CompressBound(size_t size)
+		{
+			return size + size / 255 + 16;
+		}
+
+		static size_t Compress(const uint8_t* src, size_t srcSize, uint8_t* dst)
+		{
+			uint32_t table[1 << HashBits] = {};
+
+			const uint8_t* ip = src;
+			const uint8_t* anchor = src;
+			const uint8_t* end = src + srcSize;
+			uint8_t* op = dst;
+
+			auto emitSequence = [&](const uint8_t* literalEnd, uint32_t offset, size_t matchLength)
+			{
+				size_t literalLength = literalEnd - anchor;
+				uint8_t* token = op++;
+				*token = (uint8_t)(std::min<size_t>(literalLength, 15) << 4);
+				if (literalLength >= 15)
+					op = WriteLength(op, literalLength - 15);
+
+				memcpy(op, anchor, literalLength);
+				op += literalLength;
+
+				if (matchLength == 0)
+					return;
+
+				*op++ = (uint8_t)(offset & 0xFF);
+				*op++ = (uint8_t)(offset >> 8);
+
+				matchLength -= MinMatch;
+				*token |= (uint8_t)std::min<size_t>(matchLength, 15);
+				if (matchLength >= 15)
+					op = WriteLength(op, matchLength - 15);
+			};
+
+			if (srcSize > MatchFindLimit)
+			{
+				const uint8_t* matchStartLimit = end - MatchFindLimit;
+				const uint8_t* matchEndLimit = end - LastLiterals;
+
+				// Step further the longer nothing matches, so incompressible data passes through quickly
+				uint32_t misses = 0;
+				while (ip <= matchStartLimit)
+				{
+					uint32_t sequence = Read32(ip);
+					uint32_t& slot = table[Hash(sequence)];
+					const uint8_t* ref = src + slot;
+					slot = (uint32_t)(ip - src);
+
+					if (ref >= ip || (uint32_t)(ip - ref) > MaxOffset || Read32(ref) != sequence)
+					{
+						ip += 1 + (misses++ >> 6);
+						continue;
+					}
+					misses = 0;
+
+					while (ip > anchor && ref > src && ip[-1] == ref[-1])
+					{
+						ip--;
+						ref--;
+					}
+
+					size_t matchLength = MinMatch;
+					while (ip + matchLength < matchEndLimit && ip[matchLength] == ref[matchLength])
+						matchLength++;
+
+					emitSequence(ip, (uint32_t)(ip - ref), matchLength);
+					ip += matchLength;
+					anchor = ip;
+				}
+			}
+
+			emitSequence(end, 0, 0);
+			return op - dst;
+		}
+
+		static bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+		{
+			const uint8_t* ip = src;
+			const uint8_t* inEnd = src + srcSize;
+			uint8_t* op = dst;
+			uint8_t* outEnd = dst + dstSize;
+
+			auto readLength = [&](size_t& length) -> bool
+			{
+				uint8_t value;
+				do
+				{
+					if (ip >= inEnd)
+						return false;
+					value = *ip++;
+					length += value;
+				} while (value == 255);
+				return true;
+			};
+
+			while (ip < inEnd)
+			{
+				uint8_t token = *ip++;
+
+				size_t literalLength = token >> 4;
+				if (literalLength == 15 && !readLength(literalLength))
+					return false;
+				if (literalLength > (size_t)(inEnd - ip) || literalLength > (size_t)(outEnd - op))
+					return false;
+
+				memcpy(op, ip, literalLength);
+				op += literalLength;
+				ip += literalLength;
+
+				// The last sequence has no match
+				if (ip == inEnd)
+					break;
+
+				if (inEnd - ip < 2)
+					return false;
+				size_t offset = ip[0] | (ip[1] << 8);
+				ip += 2;
+				if (offset == 0 || offset > (size_t)(op - dst))
+					return false;
+
+				size_t matchLength = token & 15;
+				if (matchLength == 15 && !readLength(matchLength))
+					return false;
+				matchLength += MinMatch;
+				if (matchLength > (size_t)(outEnd - op))
+					return false;
+
+				// Matches may overlap their own output, which repeats the pattern
+				const uint8_t* match = op - offset;
+				if (offset >= matchLength)
+				{
+					memcpy(op, match, matchLength);
+					op += matchLength;
+				}
+				else
+				{
+					for (size_t i = 0; i < matchLength; i++)
+						*op++ = match[i];
+				}
+			}
+
+			return op == outEnd;
+		}
+	}
+
+	size_t Compression::GetCompressBound(CompressionType type, size_t size)
+	{
+		switch (type)
+		{
+			case CompressionType::None: return size;
+			case CompressionType::LZ4:  return LZ4::CompressBound(size);
+		}
+
+		RM_CORE_ASSERT(false, "Unknown CompressionType!");
+		return 0;
+	}
+
+	bool Compression::Compress(CompressionType type, const void* src, size_t srcSize, std::vector<uint8_t>& out)
+	{
+		out.resize(GetCompressBound(type, srcSize));
+
+		switch (type)
+		{
+			case CompressionType::None:
+				if (srcSize)
+					memcpy(out.data(), src, srcSize);
+				return true;
+			case CompressionType::LZ4:
+				out.resize(LZ4::Compress((const uint8_t*)src, srcSize, out.data()));
+				return true;
+		}
+
+		RM_CORE_ASSERT(false, "Unknown CompressionType!");
+		return false;
+	}
+
+	bool Compression::Decompress(CompressionType type, const void* src, size_t srcSize, void* dst, size_t dstSize)
+	{
+		switch (type)
+		{
+			case CompressionType::None:
+				if (srcSize != dstSize)
+					return false;
+				if (srcSize)
+					memcpy(dst, src, srcSize);
+				return true;
+			case CompressionType::LZ4:
+				return LZ4::Decompress((const uint8_t*)src, srcSize, (uint8_t*)dst, dstSize);
+		}
+
+		RM_CORE_ASSERT(false, "Unknown CompressionType!");
+		return false;
+	}
+
+	const char* Compression::GetTypeName(CompressionType type)
+	{
+		switch (type)
+		{
+			case CompressionType::None: return "None";
+			case CompressionType::LZ4:  return "LZ4";
+		}
+
+		RM_CORE_ASSERT(false, "Unknown CompressionType!");
+		return "Unknown";
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <vector>
+
+namespace RoMan
+{
+	enum class CompressionType : uint32_t
+	{
+		None = 0, LZ4
+	};
+
+	// Block codecs for asset data. LZ4 output follows the standard LZ4 block format (no frame
+	// header), so blobs can be inspected with stock tools.
+	class Compression
+	{
+	public:
+		// Worst case output size for size input bytes
+		static size_t GetCompressBound(CompressionType type, size_t size);
+
+		// Replaces out with the compressed data
+		static bool Compress(CompressionType type, const void* src, size_t srcSize, std::vector<uint8_t>& out);
+		// dstSize must be the exact decompressed size, fails on corrupt or truncated input
+		static bool Decompress(CompressionType type, const void* src, size_t srcSize, void* dst, size_t dstSize);
+
+		static const char* GetTypeName(CompressionType type);
+	};
+}
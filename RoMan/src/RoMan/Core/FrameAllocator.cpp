@@ -0,0 +1,107 @@
+#include "rmpch.h"
+#include "FrameAllocator.h"
+
+namespace RoMan
+{
+	struct FrameArena
+	{
+		uint8_t* Buffer = nullptr;
+		size_t Offset = 0;
+
+		// Heap blocks handed out once the arena ran full, freed when the arena is reset
+		std::vector<void*> Overflow;
+	};
+
+	struct FrameAllocatorData
+	{
+		std::array<FrameArena, 2> Arenas;
+		uint32_t Current = 0;
+
+		size_t Capacity = 0;
+		size_t PeakUsed = 0;
+		bool OverflowReported = false;
+	};
+
+	static FrameAllocatorData s_Data;
+
+	static void ResetArena(FrameArena& arena)
+	{
+		for (void* block : arena.Overflow)
+			::operator delete(block);
+		arena.Overflow.clear();
+		arena.Offset = 0;
+	}
+
+	void FrameAllocator::Init(size_t capacityPerFrame)
+	{
+		RM_CORE_ASSERT(!s_Data.Capacity, "FrameAllocator already initialized!");
+
+		s_Data.Capacity = capacityPerFrame;
+		for (FrameArena& arena : s_Data.Arenas)
+		{
+			arena.Buffer = new uint8_t[capacityPerFrame];
+			arena.Overflow.reserve(64);
+		}
+	}
+
+	void FrameAllocator::Shutdown()
+	{
+		for (FrameArena& arena : s_Data.Arenas)
+		{
+			ResetArena(arena);
+			delete[] arena.Buffer;
+			arena.Buffer = nullptr;
+		}
+
+		s_Data.Capacity = 0;
+	}
+
+	void FrameAllocator::NextFrame()
+	{
+		s_Data.PeakUsed = std::max(s_Data.PeakUsed, GetUsed());
+
+		s_Data.Current = (s_Data.Current + 1) % s_Data.Arenas.size();
+		ResetArena(s_Data.Arenas[s_Data.Current]);
+	}
+
+	void* FrameAllocator::Allocate(size_t size, size_t alignment)
+	{
+		FrameArena& arena = s_Data.Arenas[s_Data.Current];
+
+		uintptr_t base = (uintptr_t)arena.Buffer;
+		uintptr_t aligned = (base + arena.Offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		size_t end = aligned - base + size;
+		if (arena.Buffer && end <= s_Data.Capacity)
+		{
+			arena.Offset = end;
+			return (void*)aligned;
+		}
+
+		// Falling back to the heap keeps things working, but defeats the point, so make it visible once
+		if (!s_Data.OverflowReported)
+		{
+			RM_CORE_WARN("FrameAllocator ran out of its {0} bytes per frame, falling back to the heap", s_Data.Capacity);
+			s_Data.OverflowReported = true;
+		}
+
+		RM_CORE_ASSERT(alignment <= alignof(std::max_align_t), "Over-aligned FrameAllocator overflow is not supported!");
+		void* block = ::operator new(size);
+		arena.Overflow.push_back(block);
+		return block;
+	}
+
+	size_t FrameAllocator::GetCapacity()
+	{
+		return s_Data.Capacity;
+	}
+
+	size_t FrameAllocator::GetUsed()
+	{
+		return s_Data.Arenas[s_Data.Current].Offset;
+	}
+
+	size_t FrameAllocator::GetPeakUsed()
+	{
+		return std::max(s_Data.PeakUsed, GetUsed());
+	}
+}
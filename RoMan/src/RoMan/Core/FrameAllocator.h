@@ -0,0 +1,63 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <string>
+#include <vector>
+
+namespace RoMan
+{
+	// Double-buffered bump allocator for transient data on the main thread.
+	// Memory handed out during a frame stays valid through the next frame and is reclaimed all at once,
+	// individual allocations are never freed.
+	class FrameAllocator
+	{
+	public:
+		static void Init(size_t capacityPerFrame);
+		static void Shutdown();
+
+		// Flips to the other arena and resets it, called once per frame by the Application
+		static void NextFrame();
+
+		static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T, typename... Args>
+		static T* New(Args&&... args)
+		{
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		static size_t GetCapacity();
+		static size_t GetUsed();
+		static size_t GetPeakUsed();
+	};
+
+	// STL allocator on top of the FrameAllocator, for containers that don't outlive the next frame
+	template<typename T>
+	class FrameAllocatorAdapter
+	{
+	public:
+		using value_type = T;
+
+		FrameAllocatorAdapter() = default;
+		template<typename U>
+		FrameAllocatorAdapter(const FrameAllocatorAdapter<U>&) {}
+
+		T* allocate(size_t count)
+		{
+			return static_cast<T*>(FrameAllocator::Allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T*, size_t) {}
+
+		template<typename U>
+		bool operator==(const FrameAllocatorAdapter<U>&) const { return true; }
+		template<typename U>
+		bool operator!=(const FrameAllocatorAdapter<U>&) const { return false; }
+	};
+
+	template<typename T>
+	using FrameVector = std::vector<T, FrameAllocatorAdapter<T>>;
+
+	using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocatorAdapter<char>>;
+}
@@ -0,0 +1,99 @@
+#include "rmpch.h"
+#include "FramePacer.h"
+
+#include "RoMan/Core/Timer.h"
+
+#include <thread>
+
+#ifdef RM_PLATFORM_WINDOWS
+	#include <timeapi.h>
+#endif
+
+namespace RoMan
+{
+	static constexpr uint64_t s_InitialSpinThreshold = 2000000; // 2ms
+	static constexpr uint64_t s_MinSpinThreshold = 200000; // 0.2ms
+
+	FramePacer::FramePacer()
+		:m_SpinThreshold(s_InitialSpinThreshold)
+	{
+	}
+
+	FramePacer::~FramePacer()
+	{
+		SetHighResolutionTimer(false);
+	}
+
+	void FramePacer::SetTargetFPS(float fps)
+	{
+		m_TargetFPS = fps;
+		m_FramePeriod = fps > 0.0f ? (uint64_t)(1e9 / fps) : 0;
+		m_NextDeadline = 0;
+
+		SetHighResolutionTimer(m_FramePeriod != 0);
+	}
+
+	void FramePacer::SetHighResolutionTimer(bool enabled)
+	{
+		if (enabled == m_HighResolutionTimer)
+			return;
+
+		m_HighResolutionTimer = enabled;
+#ifdef RM_PLATFORM_WINDOWS
+		// The default scheduler granularity of ~15.6ms is far too coarse to sleep through a frame,
+		// but a finer one costs power system wide, so it is only held while capping
+		if (enabled)
+			timeBeginPeriod(1);
+		else
+			timeEndPeriod(1);
+#endif
+	}
+
+	uint64_t FramePacer::Wait()
+	{
+		if (!m_FramePeriod)
+			return 0;
+
+		uint64_t start = Timer::Now();
+		if (!m_NextDeadline)
+			m_NextDeadline = start;
+
+		m_NextDeadline += m_FramePeriod;
+
+		// Missed the deadline by more than a frame, start over instead of rushing to catch up
+		if (start >= m_NextDeadline)
+		{
+			if (start - m_NextDeadline > m_FramePeriod)
+				m_NextDeadline = start;
+			return 0;
+		}
+
+		uint64_t now = start;
+		while (m_NextDeadline - now > m_SpinThreshold)
+		{
+			uint64_t sleepTime = m_NextDeadline - now - m_SpinThreshold;
+			std::this_thread::sleep_for(std::chrono::nanoseconds(sleepTime));
+
+			uint64_t woke = Timer::Now();
+			uint64_t overslept = woke - now > sleepTime ? woke - now - sleepTime : 0;
+
+			// Adapt to the scheduler: grow quickly on an oversleep, shrink slowly otherwise
+			if (overslept > m_SpinThreshold)
+				m_SpinThreshold = overslept;
+			else
+				m_SpinThreshold = std::max(s_MinSpinThreshold, m_SpinThreshold - (m_SpinThreshold - overslept) / 16);
+
+			now = woke;
+			if (now >= m_NextDeadline)
+				return now - start;
+		}
+
+		while (now < m_NextDeadline)
+		{
+			std::this_thread::yield();
+			now = Timer::Now();
+		}
+
+		return now - start;
+	}
+}
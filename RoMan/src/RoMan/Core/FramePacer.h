@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RoMan
+{
+	// Caps the frame rate by waiting for a per-frame deadline.
+	// Most of the wait is spent sleeping to save power, only the last stretch is spun for accuracy.
+	class FramePacer
+	{
+	public:
+		FramePacer();
+		~FramePacer();
+
+		// 0 disables the cap
+		void SetTargetFPS(float fps);
+		inline float GetTargetFPS() const { return m_TargetFPS; }
+
+		// Blocks until the current frame's deadline, returns the time waited in nanoseconds
+		uint64_t Wait();
+
+	private:
+		// Raises the OS timer resolution only while a cap needs the sleeps to be accurate
+		void SetHighResolutionTimer(bool enabled);
+
+	private:
+		float m_TargetFPS = 0.0f;
+		uint64_t m_FramePeriod = 0;
+		uint64_t m_NextDeadline = 0;
+
+		// Worst observed oversleep, sleeping stops this far ahead of the deadline
+		uint64_t m_SpinThreshold;
+		bool m_HighResolutionTimer = false;
+	};
+}
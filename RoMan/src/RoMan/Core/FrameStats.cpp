@@ -0,0 +1,256 @@
+#include "rmpch.h"
+#include "FrameStats.h"
+
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+#include <atomic>
+#include <cmath>
+#include <fstream>
+
+namespace RoMan
+{
+	struct FrameStatsData
+	{
+		FrameStatsSample Current;
+
+		std::array<FrameStatsSample, FrameStats::HistorySize> History;
+		uint32_t HistoryIndex = 0;
+		uint32_t HistoryCount = 0;
+		uint32_t FrameCount = 0;
+	};
+
+	static FrameStatsData s_Data;
+
+	// Touched from the global allocation hooks in MemoryTracker.cpp, which can run on any thread and before static init
+	static std::atomic<uint32_t> s_Allocations{ 0 };
+	static std::atomic<uint64_t> s_AllocatedBytes{ 0 };
+
+	void FrameStats::BeginFrame(Timestep ts)
+	{
+		s_Data.Current = FrameStatsSample();
+		s_Data.Current.FrameTime = ts.GetMilliSeconds();
+
+		s_Allocations.store(0, std::memory_order_relaxed);
+		s_AllocatedBytes.store(0, std::memory_order_relaxed);
+	}
+
+	void FrameStats::EndFrame()
+	{
+		FrameStatsSample& sample = s_Data.Current;
+		sample.Allocations = s_Allocations.load(std::memory_order_relaxed);
+		sample.AllocatedBytes = s_AllocatedBytes.load(std::memory_order_relaxed);
+		sample.TextureMemory = (uint64_t)MemoryTracker::GetGPUStats(GPUMemoryType::Texture).Live;
+		sample.BufferMemory = (uint64_t)(MemoryTracker::GetGPUStats(GPUMemoryType::VertexBuffer).Live
+			+ MemoryTracker::GetGPUStats(GPUMemoryType::IndexBuffer).Live);
+
+		s_Data.History[s_Data.HistoryIndex] = sample;
+		s_Data.HistoryIndex = (s_Data.HistoryIndex + 1) % HistorySize;
+		s_Data.HistoryCount = std::min(s_Data.HistoryCount + 1, HistorySize);
+		s_Data.FrameCount++;
+	}
+
+	void FrameStats::SetUpdateTime(float milliseconds)
+	{
+		s_Data.Current.UpdateTime = milliseconds;
+	}
+
+	void FrameStats::SetWaitTime(float milliseconds)
+	{
+		s_Data.Current.WaitTime = milliseconds;
+	}
+
+	void FrameStats::RecordDrawCall(uint32_t indexCount)
+	{
+		s_Data.Current.DrawCalls++;
+		s_Data.Current.Indices += indexCount;
+	}
+
+	void FrameStats::RecordStateChange()
+	{
+		s_Data.Current.StateChanges++;
+	}
+
+	void FrameStats::RecordCulledDraw()
+	{
+		s_Data.Current.CulledDraws++;
+	}
+
+	void FrameStats::RecordAllocation(size_t size)
+	{
+		s_Allocations.fetch_add(1, std::memory_order_relaxed);
+		s_AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+	}
+
+	const FrameStatsSample& FrameStats::GetLastFrame()
+	{
+		static FrameStatsSample empty;
+		if (s_Data.HistoryCount == 0)
+			return empty;
+
+		return s_Data.History[(s_Data.HistoryIndex + HistorySize - 1) % HistorySize];
+	}
+
+	FrameTimePercentiles FrameStats::GetFrameTimePercentiles()
+	{
+		FrameTimePercentiles result;
+		uint32_t count = s_Data.HistoryCount;
+		if (count == 0)
+			return result;
+
+		std::array<float, HistorySize> frameTimes;
+		for (uint32_t i = 0; i < count; i++)
+			frameTimes[i] = s_Data.History[i].FrameTime;
+
+		auto percentile = [&](float p)
+		{
+			auto nth = frameTimes.begin() + (size_t)(p * (count - 1));
+			std::nth_element(frameTimes.begin(), nth, frameTimes.begin() + count);
+			return *nth;
+		};
+
+		result.P50 = percentile(0.50f);
+		result.P95 = percentile(0.95f);
+		result.P99 = percentile(0.99f);
+		return result;
+	}
+
+	FrameTimeVariance FrameStats::GetFrameTimeVariance()
+	{
+		FrameTimeVariance result;
+		uint32_t count = s_Data.HistoryCount;
+		if (count == 0)
+			return result;
+
+		double sum = 0.0;
+		for (uint32_t i = 0; i < count; i++)
+			sum += s_Data.History[i].FrameTime;
+		double mean = sum / count;
+
+		double squaredDiffs = 0.0;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			double diff = s_Data.History[i].FrameTime - mean;
+			squaredDiffs += diff * diff;
+		}
+
+		result.Mean = (float)mean;
+		result.Variance = (float)(squaredDiffs / count);
+		result.StdDev = std::sqrt(result.Variance);
+		return result;
+	}
+
+	uint32_t FrameStats::GetFrameCount()
+	{
+		return s_Data.FrameCount;
+	}
+
+	const FrameStatsSample* FrameStats::GetHistory()
+	{
+		return s_Data.History.data();
+	}
+
+	uint32_t FrameStats::GetHistoryCount()
+	{
+		return s_Data.HistoryCount;
+	}
+
+	uint32_t FrameStats::GetHistoryOffset()
+	{
+		return s_Data.HistoryCount < HistorySize ? 0 : s_Data.HistoryIndex;
+	}
+
+	bool FrameStats::WriteCSV(const std::string& filepath)
+	{
+		std::ofstream out(filepath, std::ios::out | std::ios::trunc);
+		if (!out)
+		{
+			RM_CORE_ERROR("Couldn't open file path {0}", filepath);
+			return false;
+		}
+
+		out << "frame,frame_time_ms,update_time_ms,wait_time_ms,draw_calls,culled_draws,indices,state_changes,allocations,allocated_bytes,texture_memory,buffer_memory\n";
+
+		uint32_t count = s_Data.HistoryCount;
+		uint32_t first = (s_Data.HistoryIndex + HistorySize - count) % HistorySize;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const FrameStatsSample& sample = s_Data.History[(first + i) % HistorySize];
+			out << (s_Data.FrameCount - count + i) << ','
+				<< sample.FrameTime << ','
+				<< sample.UpdateTime << ','
+				<< sample.WaitTime << ','
+				<< sample.DrawCalls << ','
+				<< sample.CulledDraws << ','
+				<< sample.Indices << ','
+				<< sample.StateChanges << ','
+				<< sample.Allocations << ','
+				<< sample.AllocatedBytes << ','
+				<< sample.TextureMemory << ','
+				<< sample.BufferMemory << '\n';
+		}
+
+		RM_CORE_INFO("Wrote frame stats to {0}", filepath);
+		return true;
+	}
+
+	bool FrameStats::WriteJSON(const std::string& filepath)
+	{
+		std::ofstream out(filepath, std::ios::out | std::ios::trunc);
+		if (!out)
+		{
+			RM_CORE_ERROR("Couldn't open file path {0}", filepath);
+			return false;
+		}
+
+		uint32_t count = s_Data.HistoryCount;
+		uint32_t first = (s_Data.HistoryIndex + HistorySize - count) % HistorySize;
+
+		float total = 0.0f, minTime = count ? 3.4e38f : 0.0f, maxTime = 0.0f;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			float frameTime = s_Data.History[i].FrameTime;
+			total += frameTime;
+			minTime = std::min(minTime, frameTime);
+			maxTime = std::max(maxTime, frameTime);
+		}
+
+		FrameTimePercentiles percentiles = GetFrameTimePercentiles();
+		FrameTimeVariance variance = GetFrameTimeVariance();
+
+		out << "{\n";
+		out << "\t\"frames\": " << s_Data.FrameCount << ",\n";
+		out << "\t\"frameTime\": { "
+			<< "\"avg\": " << (count ? total / count : 0.0f) << ", "
+			<< "\"min\": " << minTime << ", "
+			<< "\"max\": " << maxTime << ", "
+			<< "\"p50\": " << percentiles.P50 << ", "
+			<< "\"p95\": " << percentiles.P95 << ", "
+			<< "\"p99\": " << percentiles.P99 << ", "
+			<< "\"variance\": " << variance.Variance << ", "
+			<< "\"stdDev\": " << variance.StdDev << " },\n";
+		out << "\t\"samples\": [\n";
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const FrameStatsSample& sample = s_Data.History[(first + i) % HistorySize];
+			out << "\t\t{ "
+				<< "\"frameTime\": " << sample.FrameTime << ", "
+				<< "\"updateTime\": " << sample.UpdateTime << ", "
+				<< "\"waitTime\": " << sample.WaitTime << ", "
+				<< "\"drawCalls\": " << sample.DrawCalls << ", "
+				<< "\"culledDraws\": " << sample.CulledDraws << ", "
+				<< "\"indices\": " << sample.Indices << ", "
+				<< "\"stateChanges\": " << sample.StateChanges << ", "
+				<< "\"allocations\": " << sample.Allocations << ", "
+				<< "\"allocatedBytes\": " << sample.AllocatedBytes << ", "
+				<< "\"textureMemory\": " << sample.TextureMemory << ", "
+				<< "\"bufferMemory\": " << sample.BufferMemory << " }"
+				<< (i + 1 < count ? ",\n" : "\n");
+		}
+		out << "\t]\n";
+		out << "}\n";
+
+		RM_CORE_INFO("Wrote frame stats to {0}", filepath);
+		return true;
+	}
+}
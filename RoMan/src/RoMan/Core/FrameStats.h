@@ -0,0 +1,74 @@
+#pragma once
+
+#include "RoMan/Core.h"
+#include "RoMan/Core/Timestep.h"
+
+#include <string>
+
+namespace RoMan
+{
+	struct FrameStatsSample
+	{
+		float FrameTime = 0.0f;  // ms
+		float UpdateTime = 0.0f; // ms, CPU time spent in Layer::OnUpdate
+		float WaitTime = 0.0f;   // ms, spent by the frame pacer waiting for the deadline
+
+		uint32_t DrawCalls = 0;
+		uint32_t CulledDraws = 0; // Submissions rejected by frustum culling
+		uint32_t Indices = 0;
+		uint32_t StateChanges = 0;
+
+		uint32_t Allocations = 0;
+		uint64_t AllocatedBytes = 0;
+
+		uint64_t TextureMemory = 0;
+		uint64_t BufferMemory = 0;
+	};
+
+	struct FrameTimePercentiles
+	{
+		float P50 = 0.0f;
+		float P95 = 0.0f;
+		float P99 = 0.0f;
+	};
+
+	struct FrameTimeVariance
+	{
+		float Mean = 0.0f;
+		float Variance = 0.0f;
+		float StdDev = 0.0f;
+	};
+
+	class FrameStats
+	{
+	public:
+		static constexpr uint32_t HistorySize = 512;
+
+		static void BeginFrame(Timestep ts);
+		static void EndFrame();
+
+		static void SetUpdateTime(float milliseconds);
+		static void SetWaitTime(float milliseconds);
+
+		// Renderer counters, reset every frame
+		static void RecordDrawCall(uint32_t indexCount);
+		static void RecordStateChange();
+		static void RecordCulledDraw();
+
+		static void RecordAllocation(size_t size);
+
+		// Stats of the last completed frame
+		static const FrameStatsSample& GetLastFrame();
+		static FrameTimePercentiles GetFrameTimePercentiles();
+		static FrameTimeVariance GetFrameTimeVariance();
+		static uint32_t GetFrameCount();
+
+		// Ring buffer of the last HistorySize frames, GetHistoryCount() samples are valid and the oldest is at GetHistoryOffset()
+		static const FrameStatsSample* GetHistory();
+		static uint32_t GetHistoryCount();
+		static uint32_t GetHistoryOffset();
+
+		static bool WriteCSV(const std::string& filepath);
+		static bool WriteJSON(const std::string& filepath);
+	};
+}
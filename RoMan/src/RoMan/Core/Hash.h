@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace RoMan
+{
+	// FNV-1a, 64 bit. Pass the previous result as seed to hash data in several pieces.
+	// Fine for cache keys and change detection, not for anything adversarial.
+	inline uint64_t HashFNV1a(const void* data, size_t size, uint64_t seed = 14695981039346656037ull)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		uint64_t hash = seed;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+}
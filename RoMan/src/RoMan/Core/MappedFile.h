@@ -0,0 +1,32 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <string>
+
+namespace RoMan
+{
+	// Read-only view of a whole file mapped into memory. Pages are loaded by the OS on first touch,
+	// so opening a large archive costs a single open/map no matter how much of it is used.
+	// Implemented per platform.
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool Open(const std::string& filepath);
+		void Close();
+
+		bool IsOpen() const { return m_Data != nullptr; }
+		const uint8_t* GetData() const { return m_Data; }
+		uint64_t GetSize() const { return m_Size; }
+
+	private:
+		const uint8_t* m_Data = nullptr;
+		uint64_t m_Size = 0;
+	};
+}
@@ -0,0 +1,284 @@
+#include "rmpch.h"
+#include "MemoryTracker.h"
+
+#include "RoMan/Core/FrameStats.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <new>
+
+namespace RoMan
+{
+	struct AtomicMemoryStats
+	{
+		std::atomic<int64_t> Live{ 0 };
+		std::atomic<int64_t> Peak{ 0 };
+		std::atomic<uint64_t> Allocations{ 0 };
+
+		void Add(int64_t size)
+		{
+			int64_t live = Live.fetch_add(size, std::memory_order_relaxed) + size;
+			int64_t peak = Peak.load(std::memory_order_relaxed);
+			while (live > peak && !Peak.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+				;
+			Allocations.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void Remove(int64_t size)
+		{
+			Live.fetch_sub(size, std::memory_order_relaxed);
+		}
+
+		MemoryStats Get() const
+		{
+			MemoryStats stats;
+			stats.Live = Live.load(std::memory_order_relaxed);
+			stats.Peak = Peak.load(std::memory_order_relaxed);
+			stats.Allocations = Allocations.load(std::memory_order_relaxed);
+			return stats;
+		}
+	};
+
+	struct GPUAllocation
+	{
+		GPUMemoryType Type;
+		uint64_t Size;
+	};
+
+	// Constant-initialized, the allocation hooks run before any dynamic initialization
+	static AtomicMemoryStats s_TagStats[(size_t)MemoryTag::Count];
+	static AtomicMemoryStats s_GPUStats[(size_t)GPUMemoryType::Count];
+	static thread_local MemoryTag s_CurrentTag = MemoryTag::Untagged;
+
+	static std::mutex& GetGPUAllocationsMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+
+	static std::unordered_map<const void*, GPUAllocation>& GetGPUAllocations()
+	{
+		static std::unordered_map<const void*, GPUAllocation> allocations;
+		return allocations;
+	}
+
+	void MemoryTracker::RecordAllocation(MemoryTag tag, size_t size)
+	{
+		s_TagStats[(size_t)tag].Add((int64_t)size);
+		FrameStats::RecordAllocation(size);
+	}
+
+	void MemoryTracker::RecordFree(MemoryTag tag, size_t size)
+	{
+		s_TagStats[(size_t)tag].Remove((int64_t)size);
+	}
+
+	MemoryTag MemoryTracker::GetCurrentTag()
+	{
+		return s_CurrentTag;
+	}
+
+	void MemoryTracker::SetCurrentTag(MemoryTag tag)
+	{
+		s_CurrentTag = tag;
+	}
+
+	void MemoryTracker::TrackGPUAllocation(GPUMemoryType type, const void* resource, uint64_t size)
+	{
+		s_GPUStats[(size_t)type].Add((int64_t)size);
+
+		std::lock_guard<std::mutex> lock(GetGPUAllocationsMutex());
+		GetGPUAllocations()[resource] = { type, size };
+	}
+
+	void MemoryTracker::UntrackGPUAllocation(GPUMemoryType type, const void* resource)
+	{
+		std::lock_guard<std::mutex> lock(GetGPUAllocationsMutex());
+		auto& allocations = GetGPUAllocations();
+		auto it = allocations.find(resource);
+		RM_CORE_ASSERT(it != allocations.end() && it->second.Type == type, "Untracking unknown GPU allocation!");
+		if (it == allocations.end())
+			return;
+
+		s_GPUStats[(size_t)type].Remove((int64_t)it->second.Size);
+		allocations.erase(it);
+	}
+
+	MemoryStats MemoryTracker::GetStats(MemoryTag tag)
+	{
+		return s_TagStats[(size_t)tag].Get();
+	}
+
+	MemoryStats MemoryTracker::GetGPUStats(GPUMemoryType type)
+	{
+		return s_GPUStats[(size_t)type].Get();
+	}
+
+	const char* MemoryTracker::GetTagName(MemoryTag tag)
+	{
+		switch (tag)
+		{
+			case MemoryTag::Untagged: return "Untagged";
+			case MemoryTag::Core:     return "Core";
+			case MemoryTag::Renderer: return "Renderer";
+			case MemoryTag::Shader:   return "Shader";
+			case MemoryTag::Texture:  return "Texture";
+			case MemoryTag::Layer:    return "Layer";
+			case MemoryTag::Event:    return "Event";
+			case MemoryTag::Asset:    return "Asset";
+		}
+
+		RM_CORE_ASSERT(false, "Unknown MemoryTag!");
+		return "Unknown";
+	}
+
+	const char* MemoryTracker::GetGPUMemoryTypeName(GPUMemoryType type)
+	{
+		switch (type)
+		{
+			case GPUMemoryType::VertexBuffer: return "VertexBuffer";
+			case GPUMemoryType::IndexBuffer:  return "IndexBuffer";
+			case GPUMemoryType::Texture:      return "Texture";
+		}
+
+		RM_CORE_ASSERT(false, "Unknown GPUMemoryType!");
+		return "Unknown";
+	}
+
+	bool MemoryTracker::Dump(const std::string& filepath)
+	{
+		std::ofstream out(filepath, std::ios::out | std::ios::trunc);
+		if (!out)
+		{
+			RM_CORE_ERROR("Couldn't open file path {0}", filepath);
+			return false;
+		}
+
+		out << "CPU memory (tag, live bytes, peak bytes, allocations)\n";
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++)
+		{
+			MemoryStats stats = GetStats((MemoryTag)i);
+			out << GetTagName((MemoryTag)i) << ", " << stats.Live << ", " << stats.Peak << ", " << stats.Allocations << '\n';
+		}
+
+		out << "\nGPU memory (type, live bytes, peak bytes, allocations)\n";
+		for (size_t i = 0; i < (size_t)GPUMemoryType::Count; i++)
+		{
+			MemoryStats stats = GetGPUStats((GPUMemoryType)i);
+			out << GetGPUMemoryTypeName((GPUMemoryType)i) << ", " << stats.Live << ", " << stats.Peak << ", " << stats.Allocations << '\n';
+		}
+
+		out << "\nLive GPU resources (type, resource, bytes)\n";
+		{
+			std::lock_guard<std::mutex> lock(GetGPUAllocationsMutex());
+			for (auto& [resource, allocation] : GetGPUAllocations())
+				out << GetGPUMemoryTypeName(allocation.Type) << ", " << resource << ", " << allocation.Size << '\n';
+		}
+
+		RM_CORE_INFO("Wrote memory dump to {0}", filepath);
+		return true;
+	}
+
+	void MemoryTracker::ReportLeaks()
+	{
+		std::lock_guard<std::mutex> lock(GetGPUAllocationsMutex());
+		for (auto& [resource, allocation] : GetGPUAllocations())
+			RM_CORE_WARN("Leaked {0} {1} ({2} bytes)", GetGPUMemoryTypeName(allocation.Type), resource, allocation.Size);
+	}
+}
+
+// Global allocation hooks. Every block carries a small header with its size and tag,
+// so frees are charged back to the subsystem that allocated them.
+
+namespace
+{
+	struct AllocationHeader
+	{
+		uint64_t Size;
+		RoMan::MemoryTag Tag;
+	};
+
+	// Keeps the returned pointer at the default new alignment
+	constexpr size_t s_HeaderSize = (sizeof(AllocationHeader) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+	void* TrackedAllocate(size_t size) noexcept
+	{
+		uint8_t* block = (uint8_t*)std::malloc(s_HeaderSize + size);
+		if (!block)
+			return nullptr;
+
+		AllocationHeader* header = (AllocationHeader*)block;
+		header->Size = size;
+		header->Tag = RoMan::MemoryTracker::GetCurrentTag();
+		RoMan::MemoryTracker::RecordAllocation(header->Tag, size);
+
+		return block + s_HeaderSize;
+	}
+
+	void TrackedFree(void* ptr) noexcept
+	{
+		if (!ptr)
+			return;
+
+		uint8_t* block = (uint8_t*)ptr - s_HeaderSize;
+		AllocationHeader* header = (AllocationHeader*)block;
+		RoMan::MemoryTracker::RecordFree(header->Tag, (size_t)header->Size);
+
+		std::free(block);
+	}
+}
+
+void* operator new(size_t size)
+{
+	if (void* ptr = TrackedAllocate(size))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return TrackedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	TrackedFree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	TrackedFree(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	TrackedFree(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	TrackedFree(ptr);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <string>
+
+namespace RoMan
+{
+	// Subsystem a CPU allocation is charged to, set per thread with RM_MEMORY_SCOPE
+	enum class MemoryTag : uint8_t
+	{
+		Untagged = 0, Core, Renderer, Shader, Texture, Layer, Event, Asset,
+		Count
+	};
+
+	enum class GPUMemoryType : uint8_t
+	{
+		VertexBuffer = 0, IndexBuffer, Texture,
+		Count
+	};
+
+	struct MemoryStats
+	{
+		int64_t Live = 0;
+		int64_t Peak = 0;
+		uint64_t Allocations = 0;
+	};
+
+	class MemoryTracker
+	{
+	public:
+		// Called by the global new/delete hooks
+		static void RecordAllocation(MemoryTag tag, size_t size);
+		static void RecordFree(MemoryTag tag, size_t size);
+
+		static MemoryTag GetCurrentTag();
+		static void SetCurrentTag(MemoryTag tag);
+
+		// GPU memory is tracked per resource so leaked resources can be listed
+		static void TrackGPUAllocation(GPUMemoryType type, const void* resource, uint64_t size);
+		static void UntrackGPUAllocation(GPUMemoryType type, const void* resource);
+
+		static MemoryStats GetStats(MemoryTag tag);
+		static MemoryStats GetGPUStats(GPUMemoryType type);
+
+		static const char* GetTagName(MemoryTag tag);
+		static const char* GetGPUMemoryTypeName(GPUMemoryType type);
+
+		// Live/peak counters per tag and every GPU resource still alive
+		static bool Dump(const std::string& filepath);
+		static void ReportLeaks();
+	};
+
+	class ScopedMemoryTag
+	{
+	public:
+		ScopedMemoryTag(MemoryTag tag)
+			: m_PreviousTag(MemoryTracker::GetCurrentTag())
+		{
+			MemoryTracker::SetCurrentTag(tag);
+		}
+
+		~ScopedMemoryTag()
+		{
+			MemoryTracker::SetCurrentTag(m_PreviousTag);
+		}
+
+	private:
+		MemoryTag m_PreviousTag;
+	};
+}
+
+#define RM_MEMORY_SCOPE_CONCAT_IMPL(a, b) a##b
+#define RM_MEMORY_SCOPE_CONCAT(a, b) RM_MEMORY_SCOPE_CONCAT_IMPL(a, b)
+#define RM_MEMORY_SCOPE(tag) ::RoMan::ScopedMemoryTag RM_MEMORY_SCOPE_CONCAT(memoryScope, __LINE__)(tag)
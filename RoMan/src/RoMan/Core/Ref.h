@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace RoMan
+{
+	// Base for objects owned through Ref<T>. The count lives in the object itself, so a Ref is a
+	// single pointer and copying one never touches a separate control block.
+	// Counting is single-threaded by default, call SetAtomicRefCount(true) before sharing the object
+	// with other threads.
+	class RefCounted
+	{
+	public:
+		virtual ~RefCounted() = default;
+
+		void IncRefCount() const
+		{
+			if (m_AtomicRefCount)
+				m_RefCount.fetch_add(1, std::memory_order_relaxed);
+			else
+				m_RefCount.store(m_RefCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+
+		uint32_t DecRefCount() const
+		{
+			if (m_AtomicRefCount)
+				return m_RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+
+			uint32_t count = m_RefCount.load(std::memory_order_relaxed) - 1;
+			m_RefCount.store(count, std::memory_order_relaxed);
+			return count;
+		}
+
+		uint32_t GetRefCount() const { return m_RefCount.load(std::memory_order_relaxed); }
+
+		void SetAtomicRefCount(bool atomic) { m_AtomicRefCount = atomic; }
+		bool IsAtomicRefCount() const { return m_AtomicRefCount; }
+
+	private:
+		mutable std::atomic<uint32_t> m_RefCount{ 0 };
+		bool m_AtomicRefCount = false;
+	};
+
+	template<typename T>
+	class Ref
+	{
+	public:
+		Ref() = default;
+		Ref(std::nullptr_t) {}
+
+		Ref(T* instance)
+			: m_Instance(instance)
+		{
+			IncRef();
+		}
+
+		Ref(const Ref& other)
+			: m_Instance(other.m_Instance)
+		{
+			IncRef();
+		}
+
+		Ref(Ref&& other) noexcept
+			: m_Instance(other.m_Instance)
+		{
+			other.m_Instance = nullptr;
+		}
+
+		template<typename U>
+		Ref(const Ref<U>& other)
+			: m_Instance(other.m_Instance)
+		{
+			IncRef();
+		}
+
+		template<typename U>
+		Ref(Ref<U>&& other) noexcept
+			: m_Instance(other.m_Instance)
+		{
+			other.m_Instance = nullptr;
+		}
+
+		~Ref()
+		{
+			DecRef();
+		}
+
+		Ref& operator=(std::nullptr_t)
+		{
+			reset();
+			return *this;
+		}
+
+		Ref& operator=(const Ref& other)
+		{
+			other.IncRef();
+			DecRef();
+			m_Instance = other.m_Instance;
+			return *this;
+		}
+
+		Ref& operator=(Ref&& other) noexcept
+		{
+			if (this != &other)
+			{
+				DecRef();
+				m_Instance = other.m_Instance;
+				other.m_Instance = nullptr;
+			}
+			return *this;
+		}
+
+		template<typename U>
+		Ref& operator=(const Ref<U>& other)
+		{
+			other.IncRef();
+			DecRef();
+			m_Instance = other.m_Instance;
+			return *this;
+		}
+
+		void reset(T* instance = nullptr)
+		{
+			if (instance)
+				instance->IncRefCount();
+			DecRef();
+			m_Instance = instance;
+		}
+
+		T* get() const { return m_Instance; }
+		T* operator->() const { return m_Instance; }
+		T& operator*() const { return *m_Instance; }
+
+		explicit operator bool() const { return m_Instance != nullptr; }
+
+		// Unchecked downcast, the caller knows the concrete type (e.g. the active backend)
+		template<typename U>
+		Ref<U> As() const { return Ref<U>(static_cast<U*>(m_Instance)); }
+
+		template<typename U>
+		bool operator==(const Ref<U>& other) const { return m_Instance == other.m_Instance; }
+		template<typename U>
+		bool operator!=(const Ref<U>& other) const { return m_Instance != other.m_Instance; }
+		bool operator==(std::nullptr_t) const { return m_Instance == nullptr; }
+		bool operator!=(std::nullptr_t) const { return m_Instance != nullptr; }
+
+	private:
+		void IncRef() const
+		{
+			if (m_Instance)
+				m_Instance->IncRefCount();
+		}
+
+		void DecRef() const
+		{
+			if (m_Instance && m_Instance->DecRefCount() == 0)
+				delete m_Instance;
+		}
+
+		template<typename U>
+		friend class Ref;
+
+		T* m_Instance = nullptr;
+	};
+
+	template<typename T, typename ... Args>
+	Ref<T> CreateRef(Args&& ... args)
+	{
+		return Ref<T>(new T(std::forward<Args>(args)...));
+	}
+}
@@ -0,0 +1,171 @@
+#include "rmpch.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace RoMan
+{
+	struct ThreadPoolJob
+	{
+		const std::function<void(uint32_t, uint32_t)>* Func = nullptr;
+		uint32_t Count = 0;
+		uint32_t ChunkSize = 0;
+		uint32_t ChunkCount = 0;
+	};
+
+	struct ThreadPoolData
+	{
+		std::vector<std::thread> Workers;
+
+		std::mutex JobMutex;  // Held by the thread running a ParallelFor
+		std::mutex Mutex;     // Guards everything below except the atomics
+		std::condition_variable WakeCondition;
+		std::condition_variable DoneCondition;
+
+		ThreadPoolJob Job;
+		uint64_t JobIndex = 0;
+		uint32_t ActiveWorkers = 0;
+		bool Stop = false;
+
+		std::atomic<uint32_t> NextChunk{ 0 };
+		std::atomic<uint32_t> CompletedChunks{ 0 };
+	};
+
+	static ThreadPoolData* s_Data = nullptr;
+	// Set on workers and on the thread running a ParallelFor, whose func may call ParallelFor again
+	static thread_local bool s_InParallelFor = false;
+
+	static void RunChunks(ThreadPoolData& data, const ThreadPoolJob& job)
+	{
+		uint32_t chunk;
+		while ((chunk = data.NextChunk.fetch_add(1, std::memory_order_relaxed)) < job.ChunkCount)
+		{
+			uint32_t begin = chunk * job.ChunkSize;
+			uint32_t end = std::min(begin + job.ChunkSize, job.Count);
+			(*job.Func)(begin, end);
+
+			data.CompletedChunks.fetch_add(1, std::memory_order_acq_rel);
+		}
+	}
+
+	static void WorkerLoop(ThreadPoolData& data)
+	{
+		s_InParallelFor = true;
+
+		uint64_t lastJob = 0;
+		while (true)
+		{
+			ThreadPoolJob job;
+			{
+				std::unique_lock<std::mutex> lock(data.Mutex);
+				data.WakeCondition.wait(lock, [&]() { return data.Stop || data.JobIndex != lastJob; });
+				if (data.Stop)
+					return;
+
+				lastJob = data.JobIndex;
+				job = data.Job;
+				data.ActiveWorkers++;
+			}
+
+			RunChunks(data, job);
+
+			{
+				std::lock_guard<std::mutex> lock(data.Mutex);
+				data.ActiveWorkers--;
+			}
+			data.DoneCondition.notify_one();
+		}
+	}
+
+	void ThreadPool::Init(uint32_t workerCount)
+	{
+		RM_CORE_ASSERT(!s_Data, "ThreadPool already initialized!");
+
+		if (workerCount == 0)
+		{
+			uint32_t hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+		}
+
+		s_Data = new ThreadPoolData();
+		s_Data->Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; i++)
+			s_Data->Workers.emplace_back(WorkerLoop, std::ref(*s_Data));
+
+		RM_CORE_INFO("ThreadPool started with {0} workers", workerCount);
+	}
+
+	void ThreadPool::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->Mutex);
+			s_Data->Stop = true;
+		}
+		s_Data->WakeCondition.notify_all();
+
+		for (std::thread& worker : s_Data->Workers)
+			worker.join();
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	uint32_t ThreadPool::GetWorkerCount()
+	{
+		return s_Data ? (uint32_t)s_Data->Workers.size() : 0;
+	}
+
+	void ThreadPool::ParallelFor(uint32_t count, uint32_t chunkSize, const std::function<void(uint32_t, uint32_t)>& func)
+	{
+		if (count == 0)
+			return;
+
+		chunkSize = std::max(chunkSize, 1u);
+
+		ThreadPoolJob job;
+		job.Func = &func;
+		job.Count = count;
+		job.ChunkSize = chunkSize;
+		job.ChunkCount = (count + chunkSize - 1) / chunkSize;
+
+		std::unique_lock<std::mutex> jobLock;
+		if (s_Data && !s_Data->Workers.empty() && job.ChunkCount > 1 && !s_InParallelFor)
+			jobLock = std::unique_lock<std::mutex>(s_Data->JobMutex, std::try_to_lock);
+
+		if (!jobLock.owns_lock())
+		{
+			func(0, count);
+			return;
+		}
+
+		ThreadPoolData& data = *s_Data;
+		{
+			// A worker that woke up late for the previous job may still be looking at the chunk counter
+			std::unique_lock<std::mutex> lock(data.Mutex);
+			data.DoneCondition.wait(lock, [&]() { return data.ActiveWorkers == 0; });
+
+			data.Job = job;
+			data.NextChunk.store(0, std::memory_order_relaxed);
+			data.CompletedChunks.store(0, std::memory_order_relaxed);
+			data.JobIndex++;
+		}
+		data.WakeCondition.notify_all();
+
+		s_InParallelFor = true;
+		RunChunks(data, job);
+		s_InParallelFor = false;
+
+		// Every chunk is claimed by now, wait for the workers still running theirs
+		std::unique_lock<std::mutex> lock(data.Mutex);
+		data.DoneCondition.wait(lock, [&]()
+		{
+			return data.ActiveWorkers == 0 && data.CompletedChunks.load(std::memory_order_acquire) == job.ChunkCount;
+		});
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <functional>
+
+namespace RoMan
+{
+	// Fixed set of worker threads for data-parallel loops. ParallelFor blocks until every chunk is done
+	// and the calling thread works on chunks too, so it never runs slower than a plain loop.
+	class ThreadPool
+	{
+	public:
+		// 0 uses one worker per hardware thread, minus the main thread
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		static uint32_t GetWorkerCount();
+
+		// Calls func(begin, end) over [0, count) in chunks of chunkSize.
+		// Nested calls, or calls while another thread owns the pool, run inline.
+		static void ParallelFor(uint32_t count, uint32_t chunkSize, const std::function<void(uint32_t, uint32_t)>& func);
+	};
+}
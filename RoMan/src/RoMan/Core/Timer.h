@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace RoMan
+{
+	class Timer
+	{
+	public:
+		Timer()
+		{
+			Reset();
+		}
+
+		void Reset()
+		{
+			m_Start = std::chrono::steady_clock::now();
+		}
+
+		float Elapsed() const
+		{
+			return std::chrono::duration<float>(std::chrono::steady_clock::now() - m_Start).count();
+		}
+
+		float ElapsedMillis() const
+		{
+			return Elapsed() * 1000.0f;
+		}
+
+		// Monotonic time in nanoseconds, stays exact for long uptimes unlike float seconds
+		static uint64_t Now()
+		{
+			return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+	private:
+		std::chrono::steady_clock::time_point m_Start;
+	};
+}
@@ -4,8 +4,8 @@ namespace RoMan
 	class Timestep
 	{
 	public:
-		Timestep(float time = 0.0f)
-			: m_Time(time)
+		Timestep(float time = 0.0f, float interpolationAlpha = 1.0f)
+			: m_Time(time), m_InterpolationAlpha(interpolationAlpha)
 		{
 		}
 
@@ -14,7 +14,11 @@ namespace RoMan
 		float GetSeconds() const { return m_Time; }
 		float GetMilliSeconds() const { return m_Time * 1000.0f; }
 
+		// How far the frame is between the last two fixed updates, used to interpolate rendered state
+		float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
+
 	private:
 		float m_Time;
+		float m_InterpolationAlpha;
 	};
 }
\ No newline at end of file
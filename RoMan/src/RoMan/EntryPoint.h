@@ -1,5 +1,7 @@
 #pragma once
-#ifdef RM_PLATFORM_WINDOWS
+#if defined(RM_PLATFORM_WINDOWS) || defined(RM_PLATFORM_LINUX)
+
+#include "RoMan/Core/CommandLine.h"
 
 extern RoMan::Application* RoMan::CreateApplication();
 
@@ -12,12 +14,57 @@ int main(int argc, char** argv)
 	int a = 7;
 	RM_INFO("Hello! Var = {0}", a);
 
+	// Benchmarking options, e.g. "--headless --frames 1000 --stats stats.json" or "--offscreen ..."
+	// "--binlog logs/RoMan.rmlog" records RM_BINLOG calls, without it they are dropped on the spot
+	uint32_t frameLimit = 0;
+	std::string statsPath;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--headless")
+			RoMan::RendererAPI::SetAPI(RoMan::RendererAPI::API::Null);
+		else if (arg == "--offscreen")
+			RoMan::Window::SetOffscreen(true);
+		else if (arg == "--frames" && i + 1 < argc)
+		{
+			if (!RoMan::CommandLine::ParseUInt32(argv[++i], frameLimit))
+			{
+				RM_CORE_ERROR("--frames expects a frame count, got '{0}'", argv[i]);
+				RM_CORE_INFO("Usage: [--headless | --offscreen] [--frames N] [--stats file.json|file.csv] [--binlog file.rmlog]");
+				RoMan::BinaryLog::Shutdown();
+				RoMan::Log::Shutdown();
+				return 1;
+			}
+		}
+		else if (arg == "--stats" && i + 1 < argc)
+			statsPath = argv[++i];
+		else if (arg == "--binlog" && i + 1 < argc)
+			RoMan::BinaryLog::Init(argv[++i]);
+	}
+
 	auto app = RoMan::CreateApplication();
+	app->SetFrameLimit(frameLimit);
 	app->Run();
+
+	if (!statsPath.empty())
+	{
+		bool csv = statsPath.size() >= 4 && statsPath.compare(statsPath.size() - 4, 4, ".csv") == 0;
+		if (csv)
+			RoMan::FrameStats::WriteCSV(statsPath);
+		else
+			RoMan::FrameStats::WriteJSON(statsPath);
+	}
+
 	delete app;
 
+	// Any GPU resource still alive here was never released
+	RoMan::MemoryTracker::ReportLeaks();
+
+	RoMan::BinaryLog::Shutdown();
+	RoMan::Log::Shutdown();
+
 }
 
 #else
-	#error RoMan supports only Windows!
+	#error RoMan supports only Windows and Linux!
 #endif
\ No newline at end of file
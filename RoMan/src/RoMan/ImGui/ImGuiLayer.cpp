@@ -6,6 +6,7 @@
 #include "examples/imgui_impl_opengl3.h"
 
 #include "RoMan/Application.h"
+#include "RoMan/ImGui/ImGuiPanels.h"
 
 //Temporary
 #include <glad/glad.h>
@@ -90,6 +91,10 @@ namespace RoMan
 	{
 		static bool show = true;
 		ImGui::ShowDemoWindow(&show);
+
+		ImGuiPanels::FrameStatsPanel();
+		ImGuiPanels::MemoryPanel();
+		ImGuiPanels::AssetsPanel();
 	}
 
 }
@@ -0,0 +1,164 @@
+#include "rmpch.h"
+#include "ImGuiPanels.h"
+
+#include "RoMan/Asset/AssetManager.h"
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Core/FrameStats.h"
+#include "RoMan/Core/MemoryTracker.h"
+#include "RoMan/Renderer/PostProcessStack.h"
+
+#include "imgui.h"
+
+namespace RoMan
+{
+	void ImGuiPanels::FrameStatsPanel()
+	{
+		const FrameStatsSample& last = FrameStats::GetLastFrame();
+		FrameTimePercentiles percentiles = FrameStats::GetFrameTimePercentiles();
+		FrameTimeVariance variance = FrameStats::GetFrameTimeVariance();
+
+		ImGui::Begin("Frame Stats");
+
+		ImGui::Text("Frame: %.3f ms (%.1f FPS)", last.FrameTime, last.FrameTime > 0.0f ? 1000.0f / last.FrameTime : 0.0f);
+		ImGui::Text("Update: %.3f ms  Wait: %.3f ms", last.UpdateTime, last.WaitTime);
+		ImGui::Text("p50: %.3f ms  p95: %.3f ms  p99: %.3f ms", percentiles.P50, percentiles.P95, percentiles.P99);
+		ImGui::Text("Mean: %.3f ms  Std Dev: %.3f ms", variance.Mean, variance.StdDev);
+
+		// The history is a ring buffer, so let ImGui start reading from the oldest sample
+		const FrameStatsSample* history = FrameStats::GetHistory();
+		uint32_t historyCount = FrameStats::GetHistoryCount();
+		ImGui::PlotLines("Frame Time", &history[0].FrameTime, historyCount, FrameStats::GetHistoryOffset(),
+			nullptr, 0.0f, percentiles.P99 * 1.5f, ImVec2(0, 60), sizeof(FrameStatsSample));
+
+		constexpr int bucketCount = 32;
+		std::array<float, bucketCount> buckets = {};
+		float bucketRange = std::max(percentiles.P99 * 1.5f, 1.0f);
+		for (uint32_t i = 0; i < historyCount; i++)
+		{
+			int bucket = (int)(history[i].FrameTime / bucketRange * bucketCount);
+			buckets[std::min(bucket, bucketCount - 1)] += 1.0f;
+		}
+		ImGui::PlotHistogram("Distribution", buckets.data(), bucketCount, 0, nullptr, 0.0f, 3.4e38f, ImVec2(0, 60));
+
+		ImGui::Separator();
+		ImGui::Text("Draw Calls: %u (%u culled)", last.DrawCalls, last.CulledDraws);
+		ImGui::Text("Indices: %u", last.Indices);
+		ImGui::Text("State Changes: %u", last.StateChanges);
+		ImGui::Text("Allocations: %u (%llu bytes)", last.Allocations, (unsigned long long)last.AllocatedBytes);
+		ImGui::Text("Frame Arena: %.1f / %.1f KB (peak %.1f KB)", FrameAllocator::GetUsed() / 1024.0f,
+			FrameAllocator::GetCapacity() / 1024.0f, FrameAllocator::GetPeakUsed() / 1024.0f);
+		ImGui::Text("Texture Memory: %.2f MB", last.TextureMemory / (1024.0f * 1024.0f));
+		ImGui::Text("Buffer Memory: %.2f MB", last.BufferMemory / (1024.0f * 1024.0f));
+
+		ImGui::Separator();
+		if (ImGui::Button("Write CSV"))
+			FrameStats::WriteCSV("framestats.csv");
+		ImGui::SameLine();
+		if (ImGui::Button("Write JSON"))
+			FrameStats::WriteJSON("framestats.json");
+
+		ImGui::End();
+	}
+
+	void ImGuiPanels::MemoryPanel()
+	{
+		ImGui::Begin("Memory");
+
+		ImGui::Text("CPU");
+		ImGui::Columns(4, "CPU Memory");
+		ImGui::Text("Tag"); ImGui::NextColumn();
+		ImGui::Text("Live (KB)"); ImGui::NextColumn();
+		ImGui::Text("Peak (KB)"); ImGui::NextColumn();
+		ImGui::Text("Allocations"); ImGui::NextColumn();
+		ImGui::Separator();
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++)
+		{
+			MemoryStats stats = MemoryTracker::GetStats((MemoryTag)i);
+			ImGui::Text("%s", MemoryTracker::GetTagName((MemoryTag)i)); ImGui::NextColumn();
+			ImGui::Text("%.1f", stats.Live / 1024.0f); ImGui::NextColumn();
+			ImGui::Text("%.1f", stats.Peak / 1024.0f); ImGui::NextColumn();
+			ImGui::Text("%llu", (unsigned long long)stats.Allocations); ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+
+		ImGui::Separator();
+		ImGui::Text("GPU");
+		ImGui::Columns(4, "GPU Memory");
+		ImGui::Text("Type"); ImGui::NextColumn();
+		ImGui::Text("Live (KB)"); ImGui::NextColumn();
+		ImGui::Text("Peak (KB)"); ImGui::NextColumn();
+		ImGui::Text("Allocations"); ImGui::NextColumn();
+		ImGui::Separator();
+		for (size_t i = 0; i < (size_t)GPUMemoryType::Count; i++)
+		{
+			MemoryStats stats = MemoryTracker::GetGPUStats((GPUMemoryType)i);
+			ImGui::Text("%s", MemoryTracker::GetGPUMemoryTypeName((GPUMemoryType)i)); ImGui::NextColumn();
+			ImGui::Text("%.1f", stats.Live / 1024.0f); ImGui::NextColumn();
+			ImGui::Text("%.1f", stats.Peak / 1024.0f); ImGui::NextColumn();
+			ImGui::Text("%llu", (unsigned long long)stats.Allocations); ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+
+		ImGui::Separator();
+		if (ImGui::Button("Dump"))
+			MemoryTracker::Dump("memory.txt");
+
+		ImGui::End();
+	}
+
+	void ImGuiPanels::AssetsPanel()
+	{
+		ImGui::Begin("Assets");
+
+		AssetManagerStats stats = AssetManager::GetStats();
+		ImGui::Text("Resident: %u assets, %.2f / %.2f MB", stats.AssetCount, stats.MemoryUsage / (1024.0f * 1024.0f), stats.MemoryBudget / (1024.0f * 1024.0f));
+		ImGui::Text("Hits: %llu  Misses: %llu  Evictions: %llu", (unsigned long long)stats.Hits, (unsigned long long)stats.Misses, (unsigned long long)stats.Evictions);
+		if (ImGui::Button("Unload Unused"))
+			AssetManager::UnloadUnused();
+
+		ImGui::Separator();
+		ImGui::Columns(5, "Assets");
+		ImGui::Text("Path"); ImGui::NextColumn();
+		ImGui::Text("Type"); ImGui::NextColumn();
+		ImGui::Text("Size (KB)"); ImGui::NextColumn();
+		ImGui::Text("Refs"); ImGui::NextColumn();
+		ImGui::Text("Last Used"); ImGui::NextColumn();
+		ImGui::Separator();
+		for (const AssetInfo& asset : AssetManager::GetResidentAssets())
+		{
+			ImGui::Text("%s", asset.Path.c_str()); ImGui::NextColumn();
+			ImGui::Text("%s", AssetManager::GetTypeName(asset.Type)); ImGui::NextColumn();
+			ImGui::Text("%.1f", asset.Size / 1024.0f); ImGui::NextColumn();
+			ImGui::Text("%u", asset.References); ImGui::NextColumn();
+			ImGui::Text("%u", asset.LastUsedFrame); ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+
+		ImGui::End();
+	}
+
+	void ImGuiPanels::PostProcessPanel(PostProcessStack& stack)
+	{
+		ImGui::Begin("Post Processing");
+
+		float total = 0.0f;
+		for (uint32_t i = 0; i < stack.GetPassCount(); i++)
+		{
+			PostProcessPass& pass = stack.GetPass(i);
+			ImGui::Checkbox(pass.Name.c_str(), &pass.Enabled);
+			ImGui::SameLine();
+			ImGui::Text("%.3f ms", pass.Enabled ? stack.GetPassTime(i) : 0.0f);
+
+			if (pass.Enabled)
+				total += stack.GetPassTime(i);
+		}
+
+		ImGui::Separator();
+		ImGui::Text("GPU Time: %.3f ms", total);
+		const RenderGraphStats& stats = stack.GetGraph().GetStats();
+		ImGui::Text("Passes: %u (%u culled)", stats.Passes, stats.CulledPasses);
+		ImGui::Text("Transients: %u in %u targets", stats.Transients, stats.PhysicalTargets);
+		ImGui::Text("Transient Memory: %.2f MB (%.2f MB without aliasing)", stats.AliasedMemory / (1024.0f * 1024.0f), stats.UnaliasedMemory / (1024.0f * 1024.0f));
+		ImGui::End();
+	}
+}
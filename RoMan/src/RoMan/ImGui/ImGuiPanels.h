@@ -0,0 +1,20 @@
+#pragma once
+
+namespace RoMan
+{
+	class PostProcessStack;
+
+	// Debug windows for the engine's services. They live with the ImGui layer, so the services
+	// themselves don't depend on ImGui and command-line tools link without it.
+	class ImGuiPanels
+	{
+	public:
+		// Drawn by the ImGuiLayer every frame
+		static void FrameStatsPanel();
+		static void MemoryPanel();
+		static void AssetsPanel();
+
+		// Toggles and GPU times of every pass, the stack belongs to the game
+		static void PostProcessPanel(PostProcessStack& stack);
+	};
+}
@@ -1,20 +1,153 @@
 #include "rmpch.h"
 #include "Log.h"
+#include "spdlog/async.h"
+#include "spdlog/sinks/base_sink.h"
+#include "spdlog/sinks/rotating_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 
+#include <condition_variable>
+
 namespace RoMan
 {
 	std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
 	std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
 
-	void Log::Init()
+	namespace
+	{
+		// Counts the flushes of the barrier logger. The single worker handles the queue in order, so once
+		// a barrier flush is done every message queued before it has been written.
+		class FlushBarrierSink : public spdlog::sinks::base_sink<std::mutex>
+		{
+		public:
+			uint64_t Request()
+			{
+				std::lock_guard<std::mutex> lock(m_BarrierMutex);
+				return ++m_Requested;
+			}
+
+			void Wait(uint64_t request)
+			{
+				// Bounded, so a stuck sink can't hang an assert
+				std::unique_lock<std::mutex> lock(m_BarrierMutex);
+				m_Condition.wait_for(lock, std::chrono::seconds(1), [&]() { return m_Flushed >= request; });
+			}
+
+		protected:
+			void sink_it_(const spdlog::details::log_msg&) override {}
+
+			void flush_() override
+			{
+				std::lock_guard<std::mutex> lock(m_BarrierMutex);
+				m_Flushed++;
+				m_Condition.notify_all();
+			}
+
+		private:
+			std::mutex m_BarrierMutex;
+			std::condition_variable m_Condition;
+			uint64_t m_Requested = 0;
+			uint64_t m_Flushed = 0;
+		};
+
+		std::vector<spdlog::sink_ptr> s_Sinks;
+		std::shared_ptr<FlushBarrierSink> s_FlushBarrier;
+		// Shares the sinks with the barrier last. Not registered, so only Flush reaches the barrier, and
+		// blocks when the queue is full since a dropped barrier would never be counted.
+		std::shared_ptr<spdlog::async_logger> s_FlushLogger;
+	}
+
+	static std::shared_ptr<spdlog::logger> CreateLogger(const std::string& name, bool async, LogOverflowPolicy overflow, spdlog::level::level_enum level)
+	{
+		std::shared_ptr<spdlog::logger> logger;
+		if (async)
+		{
+			auto policy = overflow == LogOverflowPolicy::Block ? spdlog::async_overflow_policy::block : spdlog::async_overflow_policy::overrun_oldest;
+			logger = std::make_shared<spdlog::async_logger>(name, s_Sinks.begin(), s_Sinks.end(), spdlog::thread_pool(), policy);
+		}
+		else
+		{
+			logger = std::make_shared<spdlog::logger>(name, s_Sinks.begin(), s_Sinks.end());
+		}
+
+		logger->set_level(level);
+		logger->flush_on(spdlog::level::warn);
+		spdlog::register_logger(logger);
+		return logger;
+	}
+
+	void Log::Init(const LogSpecification& specification)
+	{
+		auto console = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+		console->set_pattern("%^[%T] %n: %v%$");//Timestamp NameOfLogger Message
+		s_Sinks = { console };
+
+		if (!specification.FilePath.empty())
+		{
+			try
+			{
+				auto file = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(specification.FilePath, specification.MaxFileSize, specification.MaxFiles);
+				file->set_pattern("[%Y-%m-%d %T.%e] [%t] [%l] %n: %v");
+				s_Sinks.push_back(file);
+			}
+			catch (const spdlog::spdlog_ex& e)
+			{
+				console->log(spdlog::details::log_msg("ROMAN", spdlog::level::err, e.what()));
+			}
+		}
+
+		if (specification.Async)
+		{
+			// One worker keeps the sinks free of contention and the messages in order
+			spdlog::init_thread_pool(std::max(specification.QueueSize, 1u), 1);
+			s_FlushBarrier = std::make_shared<FlushBarrierSink>();
+
+			std::vector<spdlog::sink_ptr> sinks = s_Sinks;
+			sinks.push_back(s_FlushBarrier);
+			s_FlushLogger = std::make_shared<spdlog::async_logger>("FLUSH", sinks.begin(), sinks.end(), spdlog::thread_pool(), spdlog::async_overflow_policy::block);
+		}
+
+		s_CoreLogger = CreateLogger("ROMAN", specification.Async, specification.Overflow, specification.Level);
+		s_ClientLogger = CreateLogger("APP", specification.Async, specification.Overflow, specification.Level);
+
+		if (specification.Async && specification.FlushInterval > 0)
+			spdlog::flush_every(std::chrono::seconds(specification.FlushInterval));
+	}
+
+	void Log::Shutdown()
 	{
-		spdlog::set_pattern("%^[%T] %n: %v%$");//Timestamp NameOfLogger Message
+		if (!s_FlushLogger)
+			return;
 
-		s_CoreLogger = spdlog::stdout_color_mt("ROMAN");
-		s_CoreLogger->set_level(spdlog::level::trace);
+		Flush();
+
+		size_t dropped = spdlog::thread_pool()->overrun_counter();
+		spdlog::level::level_enum level = s_CoreLogger->level();
+
+		// Joins the flusher and the worker, which writes out whatever is still queued
+		s_CoreLogger.reset();
+		s_ClientLogger.reset();
+		s_FlushLogger.reset();
+		s_FlushBarrier.reset();
+		spdlog::shutdown();
+
+		// Anything logged from here on, e.g. from static destructors, is written synchronously
+		s_CoreLogger = CreateLogger("ROMAN", false, LogOverflowPolicy::Block, level);
+		s_ClientLogger = CreateLogger("APP", false, LogOverflowPolicy::Block, level);
+
+		if (dropped > 0)
+			RM_CORE_WARN("Log queue overflowed, {0} messages were dropped", dropped);
+	}
+
+	void Log::Flush()
+	{
+		if (!s_FlushLogger)
+		{
+			s_CoreLogger->flush();
+			return;
+		}
 
-		s_ClientLogger = spdlog::stdout_color_mt("APP");
-		s_ClientLogger->set_level(spdlog::level::trace);
+		uint64_t request = s_FlushBarrier->Request();
+		s_FlushLogger->flush();
+		s_FlushBarrier->Wait(request);
 	}
-}
\ No newline at end of file
+}
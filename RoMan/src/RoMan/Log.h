@@ -1,15 +1,59 @@
 #pragma once
 
 #include "Core.h"
+
+// Calls below this level compile to nothing, Dist builds keep warnings and errors only
+#ifndef SPDLOG_ACTIVE_LEVEL
+	#ifdef RM_DIST
+		#define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_WARN
+	#else
+		#define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+	#endif
+#endif
+
 #include "spdlog/spdlog.h"
 #include "spdlog/fmt/ostr.h"
 
 namespace RoMan
 {
+	enum class LogOverflowPolicy
+	{
+		// The caller waits for room in the queue, nothing is lost
+		Block = 0,
+		// The oldest queued message is dropped, the caller never waits
+		DropOldest
+	};
+
+	struct LogSpecification
+	{
+		// Messages are formatted on the calling thread and queued, a background thread applies the
+		// pattern and writes them to the sinks
+		bool Async = true;
+		// Messages, preallocated at Init
+		uint32_t QueueSize = 8192;
+		LogOverflowPolicy Overflow = LogOverflowPolicy::DropOldest;
+		// Rotating log file next to the console, empty logs to the console only
+		std::string FilePath = "logs/RoMan.log";
+		size_t MaxFileSize = 5 * 1024 * 1024;
+		size_t MaxFiles = 3;
+		// Seconds between background flushes, warnings and errors flush right away
+		uint32_t FlushInterval = 1;
+#ifdef RM_DIST
+		spdlog::level::level_enum Level = spdlog::level::warn;
+#else
+		spdlog::level::level_enum Level = spdlog::level::trace;
+#endif
+	};
+
 	class ROMAN_API Log
 	{
-	public: 
-		static void Init();
+	public:
+		static void Init(const LogSpecification& specification = {});
+		// Drains the queue and stops the background threads, logging keeps working synchronously afterwards
+		static void Shutdown();
+
+		// Blocks until every message logged so far is written out, e.g. before a debug break
+		static void Flush();
 
 		inline static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
 		inline static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
@@ -22,16 +66,16 @@ namespace RoMan
 
 // Core log macros
 
-#define RM_CORE_TRACE(...)    RoMan::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define RM_CORE_INFO(...)     RoMan::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define RM_CORE_WARN(...)     RoMan::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define RM_CORE_ERROR(...)    RoMan::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define RM_CORE_CRITICAL(...)    RoMan::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#define RM_CORE_TRACE(...)    SPDLOG_LOGGER_TRACE(RoMan::Log::GetCoreLogger(), __VA_ARGS__)
+#define RM_CORE_INFO(...)     SPDLOG_LOGGER_INFO(RoMan::Log::GetCoreLogger(), __VA_ARGS__)
+#define RM_CORE_WARN(...)     SPDLOG_LOGGER_WARN(RoMan::Log::GetCoreLogger(), __VA_ARGS__)
+#define RM_CORE_ERROR(...)    SPDLOG_LOGGER_ERROR(RoMan::Log::GetCoreLogger(), __VA_ARGS__)
+#define RM_CORE_CRITICAL(...)    SPDLOG_LOGGER_CRITICAL(RoMan::Log::GetCoreLogger(), __VA_ARGS__)
 
 // Client log macros
 
-#define RM_TRACE(...)    RoMan::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define RM_INFO(...)     RoMan::Log::GetClientLogger()->info(__VA_ARGS__)
-#define RM_WARN(...)     RoMan::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define RM_ERROR(...)    RoMan::Log::GetClientLogger()->error(__VA_ARGS__)
-#define RM_CRITICAL(...)    RoMan::Log::GetClientLogger()->critical(__VA_ARGS__)
+#define RM_TRACE(...)    SPDLOG_LOGGER_TRACE(RoMan::Log::GetClientLogger(), __VA_ARGS__)
+#define RM_INFO(...)     SPDLOG_LOGGER_INFO(RoMan::Log::GetClientLogger(), __VA_ARGS__)
+#define RM_WARN(...)     SPDLOG_LOGGER_WARN(RoMan::Log::GetClientLogger(), __VA_ARGS__)
+#define RM_ERROR(...)    SPDLOG_LOGGER_ERROR(RoMan::Log::GetClientLogger(), __VA_ARGS__)
+#define RM_CRITICAL(...)    SPDLOG_LOGGER_CRITICAL(RoMan::Log::GetClientLogger(), __VA_ARGS__)
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+
+namespace RoMan
+{
+	// Axis-aligned bounding box. Default constructed boxes are empty and never culled.
+	struct AABB
+	{
+		glm::vec3 Min = glm::vec3(0.0f);
+		glm::vec3 Max = glm::vec3(-1.0f);
+
+		AABB() = default;
+		AABB(const glm::vec3& min, const glm::vec3& max)
+			: Min(min), Max(max) {}
+
+		bool IsValid() const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+
+		glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+		glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+		// Box around this box after the transform, without transforming all 8 corners
+		AABB Transform(const glm::mat4& transform) const
+		{
+			glm::vec3 center = GetCenter();
+			glm::vec3 extents = GetExtents();
+
+			glm::vec3 newCenter(transform[3].x, transform[3].y, transform[3].z);
+			glm::vec3 newExtents(0.0f);
+			for (int column = 0; column < 3; column++)
+			{
+				for (int row = 0; row < 3; row++)
+				{
+					newCenter[row] += transform[column][row] * center[column];
+					newExtents[row] += std::fabs(transform[column][row]) * extents[column];
+				}
+			}
+
+			return AABB(newCenter - newExtents, newCenter + newExtents);
+		}
+	};
+}
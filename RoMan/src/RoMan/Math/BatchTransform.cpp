@@ -0,0 +1,424 @@
+#include "rmpch.h"
+#include "BatchTransform.h"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+	#define RM_SIMD_X86
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define RM_TARGET_AVX2
+	#else
+		// Lets GCC/Clang emit AVX2 for these functions only, the rest of the engine stays baseline
+		#define RM_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+
+namespace RoMan
+{
+	// Cody-Waite reduction by pi/2 and the Cephes single precision polynomials, shared by all kernels
+	static constexpr float s_TwoOverPi = 0.636619772367581343f;
+	static constexpr float s_PiOver2Part1 = 1.5703125f;
+	static constexpr float s_PiOver2Part2 = 4.837512969970703125e-4f;
+	static constexpr float s_PiOver2Part3 = 7.54978995489188216e-8f;
+	static constexpr float s_Sin1 = -1.6666654611e-1f;
+	static constexpr float s_Sin2 = 8.3321608736e-3f;
+	static constexpr float s_Sin3 = -1.9515295891e-4f;
+	static constexpr float s_Cos1 = 4.166664568298827e-2f;
+	static constexpr float s_Cos2 = -1.388731625493765e-3f;
+	static constexpr float s_Cos3 = 2.443315711809948e-5f;
+
+	// Corners of the unit quad, in the order of the engine's square vertex buffers
+	static constexpr float s_QuadCornersX[4] = { -0.5f, 0.5f, 0.5f, -0.5f };
+	static constexpr float s_QuadCornersY[4] = { -0.5f, -0.5f, 0.5f, 0.5f };
+
+	///////////////////////////////////////////////////////////////////////////////
+	///////////////////// Scalar //////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////
+
+	// Columns of viewProjection * T * R * S for one object
+	static void ComputeColumnsScalar(const glm::mat4& vp, const TransformSoA& t, uint32_t i, glm::vec4 columns[4])
+	{
+		float s = std::sin(t.Rotation[i]);
+		float c = std::cos(t.Rotation[i]);
+		float sx = t.ScaleX[i], sy = t.ScaleY[i], sz = t.ScaleZ[i];
+
+		columns[0] = vp[0] * (c * sx) + vp[1] * (s * sx);
+		columns[1] = vp[0] * (-s * sy) + vp[1] * (c * sy);
+		columns[2] = vp[2] * sz;
+		columns[3] = vp[0] * t.TranslationX[i] + vp[1] * t.TranslationY[i] + vp[2] * t.TranslationZ[i] + vp[3];
+	}
+
+	static void MatricesScalar(const glm::mat4& vp, const TransformSoA& t, uint32_t begin, uint32_t end, glm::mat4* out)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			glm::vec4 columns[4];
+			ComputeColumnsScalar(vp, t, i, columns);
+			for (int j = 0; j < 4; j++)
+				out[i][j] = columns[j];
+		}
+	}
+
+	static void QuadCornersScalar(const glm::mat4& vp, const TransformSoA& t, uint32_t begin, uint32_t end, glm::vec4* out)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			glm::vec4 columns[4];
+			ComputeColumnsScalar(vp, t, i, columns);
+			for (int corner = 0; corner < 4; corner++)
+				out[i * 4 + corner] = columns[0] * s_QuadCornersX[corner] + columns[1] * s_QuadCornersY[corner] + columns[3];
+		}
+	}
+
+#ifdef RM_SIMD_X86
+	///////////////////////////////////////////////////////////////////////////////
+	///////////////////// SSE2 ////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////
+
+	static inline void SinCos128(__m128 x, __m128& sinOut, __m128& cosOut)
+	{
+		__m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(s_TwoOverPi)));
+		__m128 q = _mm_cvtepi32_ps(quadrant);
+
+		__m128 y = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(s_PiOver2Part1)));
+		y = _mm_sub_ps(y, _mm_mul_ps(q, _mm_set1_ps(s_PiOver2Part2)));
+		y = _mm_sub_ps(y, _mm_mul_ps(q, _mm_set1_ps(s_PiOver2Part3)));
+		__m128 y2 = _mm_mul_ps(y, y);
+
+		__m128 s = _mm_add_ps(_mm_mul_ps(y2, _mm_set1_ps(s_Sin3)), _mm_set1_ps(s_Sin2));
+		s = _mm_add_ps(_mm_mul_ps(s, y2), _mm_set1_ps(s_Sin1));
+		s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, y2), y), y);
+
+		__m128 c = _mm_add_ps(_mm_mul_ps(y2, _mm_set1_ps(s_Cos3)), _mm_set1_ps(s_Cos2));
+		c = _mm_add_ps(_mm_mul_ps(c, y2), _mm_set1_ps(s_Cos1));
+		c = _mm_mul_ps(_mm_mul_ps(c, y2), y2);
+		c = _mm_add_ps(_mm_sub_ps(c, _mm_mul_ps(y2, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+		// Odd quadrants swap sine and cosine, then the quadrant decides the signs
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		__m128 sinValue = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+		__m128 cosValue = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+		__m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+		__m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+		sinOut = _mm_xor_ps(sinValue, sinSign);
+		cosOut = _mm_xor_ps(cosValue, cosSign);
+	}
+
+	// columns[j][r] holds component r of column j for 4 objects
+	static inline void ComputeColumns128(const glm::mat4& vp, const TransformSoA& t, uint32_t i, __m128 columns[4][4])
+	{
+		__m128 s, c;
+		SinCos128(_mm_loadu_ps(t.Rotation + i), s, c);
+
+		__m128 sx = _mm_loadu_ps(t.ScaleX + i);
+		__m128 sy = _mm_loadu_ps(t.ScaleY + i);
+		__m128 sz = _mm_loadu_ps(t.ScaleZ + i);
+		__m128 tx = _mm_loadu_ps(t.TranslationX + i);
+		__m128 ty = _mm_loadu_ps(t.TranslationY + i);
+		__m128 tz = _mm_loadu_ps(t.TranslationZ + i);
+
+		__m128 axisX0 = _mm_mul_ps(c, sx);
+		__m128 axisX1 = _mm_mul_ps(s, sx);
+		__m128 axisY0 = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(s, sy));
+		__m128 axisY1 = _mm_mul_ps(c, sy);
+
+		for (int r = 0; r < 4; r++)
+		{
+			__m128 vp0 = _mm_set1_ps(vp[0][r]);
+			__m128 vp1 = _mm_set1_ps(vp[1][r]);
+			__m128 vp2 = _mm_set1_ps(vp[2][r]);
+
+			columns[0][r] = _mm_add_ps(_mm_mul_ps(vp0, axisX0), _mm_mul_ps(vp1, axisX1));
+			columns[1][r] = _mm_add_ps(_mm_mul_ps(vp0, axisY0), _mm_mul_ps(vp1, axisY1));
+			columns[2][r] = _mm_mul_ps(vp2, sz);
+			columns[3][r] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vp0, tx), _mm_mul_ps(vp1, ty)),
+				_mm_add_ps(_mm_mul_ps(vp2, tz), _mm_set1_ps(vp[3][r])));
+		}
+	}
+
+	static void MatricesSSE2(const glm::mat4& vp, const TransformSoA& t, uint32_t begin, uint32_t end, glm::mat4* out)
+	{
+		for (uint32_t i = begin; i < end; i += 4)
+		{
+			__m128 columns[4][4];
+			ComputeColumns128(vp, t, i, columns);
+
+			for (int j = 0; j < 4; j++)
+			{
+				_MM_TRANSPOSE4_PS(columns[j][0], columns[j][1], columns[j][2], columns[j][3]);
+				for (int lane = 0; lane < 4; lane++)
+					_mm_storeu_ps(&out[i + lane][j][0], columns[j][lane]);
+			}
+		}
+	}
+
+	static void QuadCornersSSE2(const glm::mat4& vp, const TransformSoA& t, uint32_t begin, uint32_t end, glm::vec4* out)
+	{
+		for (uint32_t i = begin; i < end; i += 4)
+		{
+			__m128 columns[4][4];
+			ComputeColumns128(vp, t, i, columns);
+
+			for (int corner = 0; corner < 4; corner++)
+			{
+				__m128 px = _mm_set1_ps(s_QuadCornersX[corner]);
+				__m128 py = _mm_set1_ps(s_QuadCornersY[corner]);
+
+				__m128 position[4];
+				for (int r = 0; r < 4; r++)
+					position[r] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(columns[0][r], px), _mm_mul_ps(columns[1][r], py)), columns[3][r]);
+
+				_MM_TRANSPOSE4_PS(position[0], position[1], position[2], position[3]);
+				for (int lane = 0; lane < 4; lane++)
+					_mm_storeu_ps(&out[(i + lane) * 4 + corner][0], position[lane]);
+			}
+		}
+	}
+
+	///////////////////////////////////////////////////////////////////////////////
+	///////////////////// AVX2 ////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////
+
+	RM_TARGET_AVX2 static inline void SinCos256(__m256 x, __m256& sinOut, __m256& cosOut)
+	{
+		__m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(s_TwoOverPi)));
+		__m256 q = _mm256_cvtepi32_ps(quadrant);
+
+		__m256 y = _mm256_sub_ps(x, _mm256_mul_ps(q, _mm256_set1_ps(s_PiOver2Part1)));
+		y = _mm256_sub_ps(y, _mm256_mul_ps(q, _mm256_set1_ps(s_PiOver2Part2)));
+		y = _mm256_sub_ps(y, _mm256_mul_ps(q, _mm256_set1_ps(s_PiOver2Part3)));
+		__m256 y2 = _mm256_mul_ps(y, y);
+
+		__m256 s = _mm256_add_ps(_mm256_mul_ps(y2, _mm256_set1_ps(s_Sin3)), _mm256_set1_ps(s_Sin2));
+		s = _mm256_add_ps(_mm256_mul_ps(s, y2), _mm256_set1_ps(s_Sin1));
+		s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(s, y2), y), y);
+
+		__m256 c = _mm256_add_ps(_mm256_mul_ps(y2, _mm256_set1_ps(s_Cos3)), _mm256_set1_ps(s_Cos2));
+		c = _mm256_add_ps(_mm256_mul_ps(c, y2), _mm256_set1_ps(s_Cos1));
+		c = _mm256_mul_ps(_mm256_mul_ps(c, y2), y2);
+		c = _mm256_add_ps(_mm256_sub_ps(c, _mm256_mul_ps(y2, _mm256_set1_ps(0.5f))), _mm256_set1_ps(1.0f));
+
+		__m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+		__m256 sinValue = _mm256_blendv_ps(s, c, swap);
+		__m256 cosValue = _mm256_blendv_ps(c, s, swap);
+
+		__m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(2)), 30));
+		__m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+		sinOut = _mm256_xor_ps(sinValue, sinSign);
+		cosOut = _mm256_xor_ps(cosValue, cosSign);
+	}
+
+	RM_TARGET_AVX2 static inline void ComputeColumns256(const glm::mat4& vp, const TransformSoA& t, uint32_t i, __m256 columns[4][4])
+	{
+		__m256 s, c;
+		SinCos256(_mm256_loadu_ps(t.Rotation + i), s, c);
+
+		__m256 sx = _mm256_loadu_ps(t.ScaleX + i);
+		__m256 sy = _mm256_loadu_ps(t.ScaleY + i);
+		__m256 sz = _mm256_loadu_ps(t.ScaleZ + i);
+		__m256 tx = _mm256_loadu_ps(t.TranslationX + i);
+		__m256 ty = _mm256_loadu_ps(t.TranslationY + i);
+		__m256 tz = _mm256_loadu_ps(t.TranslationZ + i);
+
+		__m256 axisX0 = _mm256_mul_ps(c, sx);
+		__m256 axisX1 = _mm256_mul_ps(s, sx);
+		__m256 axisY0 = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(s, sy));
+		__m256 axisY1 = _mm256_mul_ps(c, sy);
+
+		for (int r = 0; r < 4; r++)
+		{
+			__m256 vp0 = _mm256_set1_ps(vp[0][r]);
+			__m256 vp1 = _mm256_set1_ps(vp[1][r]);
+			__m256 vp2 = _mm256_set1_ps(vp[2][r]);
+
+			columns[0][r] = _mm256_add_ps(_mm256_mul_ps(vp0, axisX0), _mm256_mul_ps(vp1, axisX1));
+			columns[1][r] = _mm256_add_ps(_mm256_mul_ps(vp0, axisY0), _mm256_mul_ps(vp1, axisY1));
+			columns[2][r] = _mm256_mul_ps(vp2, sz);
+			columns[3][r] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vp0, tx), _mm256_mul_ps(vp1, ty)),
+				_mm256_add_ps(_mm256_mul_ps(vp2, tz), _mm256_set1_ps(vp[3][r])));
+		}
+	}
+
+	// Transposes 4 component vectors of 8 objects into 8 vec4s, the low and high halves go through the SSE transpose
+	RM_TARGET_AVX2 static inline void Store8(const __m256 components[4], float* base, size_t objectStride)
+	{
+		__m128 low[4], high[4];
+		for (int r = 0; r < 4; r++)
+		{
+			low[r] = _mm256_castps256_ps128(components[r]);
+			high[r] = _mm256_extractf128_ps(components[r], 1);
+		}
+
+		_MM_TRANSPOSE4_PS(low[0], low[1], low[2], low[3]);
+		_MM_TRANSPOSE4_PS(high[0], high[1], high[2], high[3]);
+		for (int lane = 0; lane < 4; lane++)
+		{
+			_mm_storeu_ps(base + lane * objectStride, low[lane]);
+			_mm_storeu_ps(base + (lane + 4) * objectStride, high[lane]);
+		}
+	}
+
+	RM_TARGET_AVX2 static void MatricesAVX2(const glm::mat4& vp, const TransformSoA& t, uint32_t begin, uint32_t end, glm::mat4* out)
+	{
+		for (uint32_t i = begin; i < end; i += 8)
+		{
+			__m256 columns[4][4];
+			ComputeColumns256(vp, t, i, columns);
+
+			for (int j = 0; j < 4; j++)
+				Store8(columns[j], &out[i][j][0], 16);
+		}
+	}
+
+	RM_TARGET_AVX2 static void QuadCornersAVX2(const glm::mat4& vp, const TransformSoA& t, uint32_t begin, uint32_t end, glm::vec4* out)
+	{
+		for (uint32_t i = begin; i < end; i += 8)
+		{
+			__m256 columns[4][4];
+			ComputeColumns256(vp, t, i, columns);
+
+			for (int corner = 0; corner < 4; corner++)
+			{
+				__m256 px = _mm256_set1_ps(s_QuadCornersX[corner]);
+				__m256 py = _mm256_set1_ps(s_QuadCornersY[corner]);
+
+				__m256 position[4];
+				for (int r = 0; r < 4; r++)
+					position[r] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(columns[0][r], px), _mm256_mul_ps(columns[1][r], py)), columns[3][r]);
+
+				Store8(position, &out[i * 4 + corner][0], 16);
+			}
+		}
+	}
+
+	static SimdLevel DetectSimdLevel()
+	{
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] >= 7)
+		{
+			__cpuid(info, 1);
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+			bool avx = (info[2] & (1 << 28)) != 0;
+			// The OS has to save the YMM registers on context switches
+			if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+			{
+				__cpuidex(info, 7, 0);
+				if (info[1] & (1 << 5))
+					return SimdLevel::AVX2;
+			}
+		}
+		return SimdLevel::SSE2;
+#else
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			return SimdLevel::AVX2;
+		if (__builtin_cpu_supports("sse2"))
+			return SimdLevel::SSE2;
+		return SimdLevel::Scalar;
+#endif
+	}
+#else
+	static SimdLevel DetectSimdLevel()
+	{
+		return SimdLevel::Scalar;
+	}
+#endif
+
+	static SimdLevel& GetSupportedLevelStorage()
+	{
+		static SimdLevel supported = DetectSimdLevel();
+		return supported;
+	}
+
+	static SimdLevel& GetActiveLevelStorage()
+	{
+		static SimdLevel active = GetSupportedLevelStorage();
+		return active;
+	}
+
+	void BatchTransform::ComputeMVPMatrices(const glm::mat4& viewProjection, const TransformSoA& transforms, glm::mat4* out)
+	{
+		uint32_t count = transforms.Count;
+		uint32_t vectorized = 0;
+
+#ifdef RM_SIMD_X86
+		switch (GetSimdLevel())
+		{
+			case SimdLevel::AVX2:
+				vectorized = count & ~7u;
+				MatricesAVX2(viewProjection, transforms, 0, vectorized, out);
+				break;
+			case SimdLevel::SSE2:
+				vectorized = count & ~3u;
+				MatricesSSE2(viewProjection, transforms, 0, vectorized, out);
+				break;
+			case SimdLevel::Scalar:
+				break;
+		}
+#endif
+
+		MatricesScalar(viewProjection, transforms, vectorized, count, out);
+	}
+
+	void BatchTransform::ComputeModelMatrices(const TransformSoA& transforms, glm::mat4* out)
+	{
+		ComputeMVPMatrices(glm::mat4(1.0f), transforms, out);
+	}
+
+	void BatchTransform::ComputeQuadCorners(const glm::mat4& viewProjection, const TransformSoA& transforms, glm::vec4* out)
+	{
+		uint32_t count = transforms.Count;
+		uint32_t vectorized = 0;
+
+#ifdef RM_SIMD_X86
+		switch (GetSimdLevel())
+		{
+			case SimdLevel::AVX2:
+				vectorized = count & ~7u;
+				QuadCornersAVX2(viewProjection, transforms, 0, vectorized, out);
+				break;
+			case SimdLevel::SSE2:
+				vectorized = count & ~3u;
+				QuadCornersSSE2(viewProjection, transforms, 0, vectorized, out);
+				break;
+			case SimdLevel::Scalar:
+				break;
+		}
+#endif
+
+		QuadCornersScalar(viewProjection, transforms, vectorized, count, out);
+	}
+
+	SimdLevel BatchTransform::GetSimdLevel()
+	{
+		return GetActiveLevelStorage();
+	}
+
+	void BatchTransform::SetSimdLevel(SimdLevel level)
+	{
+		GetActiveLevelStorage() = std::min(level, GetSupportedSimdLevel());
+	}
+
+	SimdLevel BatchTransform::GetSupportedSimdLevel()
+	{
+		return GetSupportedLevelStorage();
+	}
+
+	const char* BatchTransform::GetSimdLevelName(SimdLevel level)
+	{
+		switch (level)
+		{
+			case SimdLevel::Scalar: return "Scalar";
+			case SimdLevel::SSE2:   return "SSE2";
+			case SimdLevel::AVX2:   return "AVX2";
+		}
+
+		RM_CORE_ASSERT(false, "Unknown SimdLevel!");
+		return "Unknown";
+	}
+}
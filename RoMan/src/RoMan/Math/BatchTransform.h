@@ -0,0 +1,49 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <glm/glm.hpp>
+
+namespace RoMan
+{
+	// Per-object 2D transforms in structure-of-arrays form: translation, rotation around Z in radians
+	// and scale. Every array holds Count elements. The SIMD sine/cosine lose precision for rotations
+	// beyond a few thousand radians, keep angles wrapped.
+	struct TransformSoA
+	{
+		const float* TranslationX = nullptr;
+		const float* TranslationY = nullptr;
+		const float* TranslationZ = nullptr;
+		const float* Rotation = nullptr;
+		const float* ScaleX = nullptr;
+		const float* ScaleY = nullptr;
+		const float* ScaleZ = nullptr;
+		uint32_t Count = 0;
+	};
+
+	enum class SimdLevel
+	{
+		Scalar = 0, SSE2, AVX2
+	};
+
+	// Batch kernels computing translate * rotate * scale for many objects at once, 4 (SSE2) or 8 (AVX2)
+	// objects per iteration. The widest level the CPU supports is picked at startup.
+	class BatchTransform
+	{
+	public:
+		// out[i] = T * R * S
+		static void ComputeModelMatrices(const TransformSoA& transforms, glm::mat4* out);
+		// out[i] = viewProjection * T * R * S
+		static void ComputeMVPMatrices(const glm::mat4& viewProjection, const TransformSoA& transforms, glm::mat4* out);
+		// Clip space corners of a unit quad centered on the origin, 4 per object in the order
+		// (-0.5, -0.5), (0.5, -0.5), (0.5, 0.5), (-0.5, 0.5) to match the engine's quad index layout
+		static void ComputeQuadCorners(const glm::mat4& viewProjection, const TransformSoA& transforms, glm::vec4* out);
+
+		static SimdLevel GetSimdLevel();
+		// Clamped to what the CPU supports, mostly useful to compare the kernels
+		static void SetSimdLevel(SimdLevel level);
+		static SimdLevel GetSupportedSimdLevel();
+
+		static const char* GetSimdLevelName(SimdLevel level);
+	};
+}
@@ -0,0 +1,109 @@
+#include "rmpch.h"
+#include "Frustum.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+	#define RM_SIMD_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace RoMan
+{
+	Frustum::Frustum(const glm::mat4& viewProjection)
+	{
+		// Gribb/Hartmann: each clip plane is the last row of the matrix plus or minus another row.
+		// Planes aren't normalized, the sign of the distance is all culling needs.
+		const glm::mat4& m = viewProjection;
+		for (int plane = 0; plane < 6; plane++)
+		{
+			int row = plane / 2;
+			float sign = (plane % 2 == 0) ? 1.0f : -1.0f;
+			m_NormalX[plane] = m[0][3] + sign * m[0][row];
+			m_NormalY[plane] = m[1][3] + sign * m[1][row];
+			m_NormalZ[plane] = m[2][3] + sign * m[2][row];
+			m_Distance[plane] = m[3][3] + sign * m[3][row];
+		}
+	}
+
+	bool Frustum::IsVisible(const AABB& box) const
+	{
+		if (!box.IsValid())
+			return true;
+
+		return IsVisible(box.GetCenter(), box.GetExtents());
+	}
+
+	bool Frustum::IsVisible(const glm::vec3& center, const glm::vec3& extents) const
+	{
+#ifdef RM_SIMD_SSE2
+		// A box is outside if it lies fully behind any plane: distance of the center plus the
+		// projected radius of the box is negative
+		__m128 cx = _mm_set1_ps(center.x), cy = _mm_set1_ps(center.y), cz = _mm_set1_ps(center.z);
+		__m128 ex = _mm_set1_ps(extents.x), ey = _mm_set1_ps(extents.y), ez = _mm_set1_ps(extents.z);
+		__m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+		int outside = 0;
+		for (int i = 0; i < 8; i += 4)
+		{
+			__m128 nx = _mm_load_ps(m_NormalX + i);
+			__m128 ny = _mm_load_ps(m_NormalY + i);
+			__m128 nz = _mm_load_ps(m_NormalZ + i);
+
+			__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)),
+				_mm_add_ps(_mm_mul_ps(nz, cz), _mm_load_ps(m_Distance + i)));
+			__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(nx, absMask), ex), _mm_mul_ps(_mm_and_ps(ny, absMask), ey)),
+				_mm_mul_ps(_mm_and_ps(nz, absMask), ez));
+
+			outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+		}
+		return outside == 0;
+#else
+		for (int i = 0; i < 6; i++)
+		{
+			float distance = m_NormalX[i] * center.x + m_NormalY[i] * center.y + m_NormalZ[i] * center.z + m_Distance[i];
+			float radius = std::fabs(m_NormalX[i]) * extents.x + std::fabs(m_NormalY[i]) * extents.y + std::fabs(m_NormalZ[i]) * extents.z;
+			if (distance + radius < 0.0f)
+				return false;
+		}
+		return true;
+#endif
+	}
+
+	void Frustum::CullBoxes(const float* centerX, const float* centerY, const float* centerZ,
+		const float* extentX, const float* extentY, const float* extentZ,
+		uint32_t count, uint8_t* visible) const
+	{
+		uint32_t i = 0;
+
+#ifdef RM_SIMD_SSE2
+		// 4 boxes per iteration against one plane at a time
+		__m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 cx = _mm_loadu_ps(centerX + i), cy = _mm_loadu_ps(centerY + i), cz = _mm_loadu_ps(centerZ + i);
+			__m128 ex = _mm_loadu_ps(extentX + i), ey = _mm_loadu_ps(extentY + i), ez = _mm_loadu_ps(extentZ + i);
+
+			__m128 outside = _mm_setzero_ps();
+			for (int plane = 0; plane < 6; plane++)
+			{
+				__m128 nx = _mm_set1_ps(m_NormalX[plane]);
+				__m128 ny = _mm_set1_ps(m_NormalY[plane]);
+				__m128 nz = _mm_set1_ps(m_NormalZ[plane]);
+
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)),
+					_mm_add_ps(_mm_mul_ps(nz, cz), _mm_set1_ps(m_Distance[plane])));
+				__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(nx, absMask), ex), _mm_mul_ps(_mm_and_ps(ny, absMask), ey)),
+					_mm_mul_ps(_mm_and_ps(nz, absMask), ez));
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+			}
+
+			int mask = _mm_movemask_ps(outside);
+			for (int lane = 0; lane < 4; lane++)
+				visible[i + lane] = (mask & (1 << lane)) ? 0 : 1;
+		}
+#endif
+
+		for (; i < count; i++)
+			visible[i] = IsVisible({ centerX[i], centerY[i], centerZ[i] }, { extentX[i], extentY[i], extentZ[i] }) ? 1 : 0;
+	}
+}
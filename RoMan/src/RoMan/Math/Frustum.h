@@ -0,0 +1,30 @@
+#pragma once
+
+#include "RoMan/Math/AABB.h"
+
+namespace RoMan
+{
+	// View volume as 6 planes (left, right, bottom, top, near, far) facing inwards, stored as
+	// structure-of-arrays so a box is tested against all planes at once
+	class Frustum
+	{
+	public:
+		Frustum() = default;
+		explicit Frustum(const glm::mat4& viewProjection);
+
+		bool IsVisible(const AABB& box) const;
+		bool IsVisible(const glm::vec3& center, const glm::vec3& extents) const;
+
+		// visible[i] = 1 if box i intersects the frustum. Boxes are given as centers and half extents.
+		void CullBoxes(const float* centerX, const float* centerY, const float* centerZ,
+			const float* extentX, const float* extentY, const float* extentZ,
+			uint32_t count, uint8_t* visible) const;
+
+	private:
+		// 8 lanes so two SSE registers cover all planes, the padding planes always pass
+		alignas(16) float m_NormalX[8] = {};
+		alignas(16) float m_NormalY[8] = {};
+		alignas(16) float m_NormalZ[8] = {};
+		alignas(16) float m_Distance[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+	};
+}
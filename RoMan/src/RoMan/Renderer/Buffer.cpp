@@ -1,13 +1,17 @@
 #include "rmpch.h"
 #include "Buffer.h"
 #include "Renderer.h"
+#include "RoMan/Core/MemoryTracker.h"
 
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Null/NullBuffer.h"
 
 namespace RoMan
 {
 	VertexBuffer* VertexBuffer::Create(float* vertices, uint32_t size)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Renderer);
+
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
@@ -16,6 +20,9 @@ namespace RoMan
 		
 		case RendererAPI::API::OpenGL:
 			return new OpenGLVertexBuffer(vertices, size);
+
+		case RendererAPI::API::Null:
+			return new NullVertexBuffer(vertices, size);
 		}
 
 		RM_CORE_ASSERT(false, "Unknown RenderAPI!");
@@ -24,6 +31,8 @@ namespace RoMan
 
 	IndexBuffer* IndexBuffer::Create(uint32_t* indices, uint32_t count)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Renderer);
+
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
@@ -32,6 +41,9 @@ namespace RoMan
 
 		case RendererAPI::API::OpenGL:
 			return new OpenGLIndexBuffer(indices, count);
+
+		case RendererAPI::API::Null:
+			return new NullIndexBuffer(indices, count);
 		}
 
 		RM_CORE_ASSERT(false, "Unknown RenderAPI!");
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RoMan/Renderer/RenderHandle.h"
+
 namespace RoMan
 {
 	enum class ShaderDataType
@@ -104,7 +106,7 @@ namespace RoMan
 	};
 
 
-	class VertexBuffer
+	class VertexBuffer : public RefCounted
 	{
 	public:
 		virtual ~VertexBuffer() = default;
@@ -115,10 +117,12 @@ namespace RoMan
 		virtual const BufferLayout& GetLayout() const = 0;
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 
+		virtual BufferHandle GetHandle() const = 0;
+
 		static VertexBuffer* Create(float* vertices, uint32_t size);
 	};
 
-	class IndexBuffer
+	class IndexBuffer : public RefCounted
 	{
 	public:
 		virtual ~IndexBuffer() = default;
@@ -128,6 +132,8 @@ namespace RoMan
 
 		virtual uint32_t GetCount() const = 0;
 
+		virtual BufferHandle GetHandle() const = 0;
+
 		static IndexBuffer* Create(uint32_t* vertices, uint32_t size);
 	};
 }
@@ -0,0 +1,39 @@
+#include "rmpch.h"
+#include "Camera.h"
+
+namespace RoMan
+{
+	const glm::mat4& Camera::GetProjectionMatrix() const
+	{
+		if (m_ProjectionDirty)
+		{
+			m_ProjectionMatrix = CalculateProjectionMatrix();
+			m_ProjectionDirty = false;
+			m_ViewProjectionDirty = true;
+		}
+		return m_ProjectionMatrix;
+	}
+
+	const glm::mat4& Camera::GetViewMatrix() const
+	{
+		if (m_ViewDirty)
+		{
+			m_ViewMatrix = CalculateViewMatrix();
+			m_ViewDirty = false;
+			m_ViewProjectionDirty = true;
+		}
+		return m_ViewMatrix;
+	}
+
+	const glm::mat4& Camera::GetViewProjectionMatrix() const
+	{
+		const glm::mat4& projection = GetProjectionMatrix();
+		const glm::mat4& view = GetViewMatrix();
+		if (m_ViewProjectionDirty)
+		{
+			m_ViewProjectionMatrix = projection * view;
+			m_ViewProjectionDirty = false;
+		}
+		return m_ViewProjectionMatrix;
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "glm/glm.hpp"
+
+#include "RoMan/Math/AABB.h"
+
+namespace RoMan
+{
+	// Base for cameras the renderer can draw with. Setters only mark matrices dirty, they are rebuilt
+	// on the next getter call, so moving a camera several times per frame costs one rebuild.
+	class Camera
+	{
+	public:
+		virtual ~Camera() = default;
+
+		const glm::vec3& GetPosition() const { return m_Position; }
+		void SetPosition(const glm::vec3& position) { m_Position = position; InvalidateView(); }
+
+		const glm::mat4& GetProjectionMatrix() const;
+		const glm::mat4& GetViewMatrix() const;
+		const glm::mat4& GetViewProjectionMatrix() const;
+
+		// World space box around everything the camera can see
+		virtual AABB GetBounds() const = 0;
+
+	protected:
+		virtual glm::mat4 CalculateProjectionMatrix() const = 0;
+		virtual glm::mat4 CalculateViewMatrix() const = 0;
+
+		void InvalidateProjection() { m_ProjectionDirty = true; }
+		void InvalidateView() { m_ViewDirty = true; }
+
+	protected:
+		glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
+
+	private:
+		mutable glm::mat4 m_ProjectionMatrix = glm::mat4(1.0f);
+		mutable glm::mat4 m_ViewMatrix = glm::mat4(1.0f);
+		mutable glm::mat4 m_ViewProjectionMatrix = glm::mat4(1.0f);
+
+		mutable bool m_ProjectionDirty = true;
+		mutable bool m_ViewDirty = true;
+		mutable bool m_ViewProjectionDirty = true;
+	};
+}
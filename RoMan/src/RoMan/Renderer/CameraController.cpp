@@ -0,0 +1,194 @@
+#include "rmpch.h"
+#include "CameraController.h"
+
+#include "RoMan/Application.h"
+#include "RoMan/Input.h"
+#include "RoMan/KeyCodes.h"
+#include "RoMan/MouseButtonCodes.h"
+
+namespace RoMan
+{
+	static glm::vec2 GetWindowSize()
+	{
+		Window& window = Application::Get().GetWindow();
+		return { (float)std::max(window.GetWidth(), 1u), (float)std::max(window.GetHeight(), 1u) };
+	}
+
+	static glm::vec2 GetMousePosition()
+	{
+		auto [x, y] = Input::GetMousePosition();
+		return { x, y };
+	}
+
+	OrthographicCameraController::OrthographicCameraController(float aspectRatio, bool rotation)
+		: m_AspectRatio(aspectRatio), m_ViewportSize(GetWindowSize()),
+		m_Camera(-aspectRatio * m_ZoomLevel, aspectRatio * m_ZoomLevel, -m_ZoomLevel, m_ZoomLevel), m_Rotation(rotation)
+	{
+	}
+
+	void OrthographicCameraController::OnUpdate(Timestep ts)
+	{
+		// Pan in screen directions, so a rotated view still moves the way the keys point
+		glm::vec2 move(0.0f);
+		if (Input::IsKeyPressed(RM_KEY_LEFT) || Input::IsKeyPressed(RM_KEY_A))
+			move.x -= 1.0f;
+		if (Input::IsKeyPressed(RM_KEY_RIGHT) || Input::IsKeyPressed(RM_KEY_D))
+			move.x += 1.0f;
+		if (Input::IsKeyPressed(RM_KEY_UP) || Input::IsKeyPressed(RM_KEY_W))
+			move.y += 1.0f;
+		if (Input::IsKeyPressed(RM_KEY_DOWN) || Input::IsKeyPressed(RM_KEY_S))
+			move.y -= 1.0f;
+
+		glm::vec3 position = m_Camera.GetPosition();
+		if (move.x != 0.0f || move.y != 0.0f)
+		{
+			float rotation = glm::radians(m_Camera.GetRotation());
+			float cosine = std::cos(rotation), sine = std::sin(rotation);
+			float distance = m_TranslationSpeed * m_ZoomLevel * ts;
+
+			position.x += (cosine * move.x - sine * move.y) * distance;
+			position.y += (sine * move.x + cosine * move.y) * distance;
+		}
+
+		// Drag keeps the world point under the cursor fixed
+		glm::vec2 mousePosition = GetMousePosition();
+		if (Input::IsMouseButtonPressed(RM_MOUSE_BUTTON_MIDDLE))
+		{
+			if (m_Dragging)
+			{
+				glm::vec2 delta = m_Camera.ScreenToWorld(m_LastMousePosition, m_ViewportSize) - m_Camera.ScreenToWorld(mousePosition, m_ViewportSize);
+				position.x += delta.x;
+				position.y += delta.y;
+			}
+			m_Dragging = true;
+		}
+		else
+		{
+			m_Dragging = false;
+		}
+		m_LastMousePosition = mousePosition;
+
+		if (position != m_Camera.GetPosition())
+			m_Camera.SetPosition(position);
+
+		if (m_Rotation)
+		{
+			if (Input::IsKeyPressed(RM_KEY_Q))
+				m_Camera.SetRotation(m_Camera.GetRotation() + m_RotationSpeed * ts);
+			if (Input::IsKeyPressed(RM_KEY_E))
+				m_Camera.SetRotation(m_Camera.GetRotation() - m_RotationSpeed * ts);
+		}
+	}
+
+	void OrthographicCameraController::OnEvent(Event& e)
+	{
+		EventDispatcher dispatcher(e);
+		dispatcher.Dispatch<MouseScrolledEvent>(RM_BIND_EVENT_FN(OrthographicCameraController::OnMouseScrolled));
+		dispatcher.Dispatch<WindowResizeEvent>(RM_BIND_EVENT_FN(OrthographicCameraController::OnWindowResized));
+	}
+
+	void OrthographicCameraController::SetZoomLevel(float zoomLevel)
+	{
+		m_ZoomLevel = std::max(zoomLevel, 0.05f);
+		UpdateProjection();
+	}
+
+	bool OrthographicCameraController::OnMouseScrolled(MouseScrolledEvent& e)
+	{
+		glm::vec2 mousePosition = GetMousePosition();
+		glm::vec2 before = m_Camera.ScreenToWorld(mousePosition, m_ViewportSize);
+
+		// Multiplicative steps feel the same at every zoom level
+		SetZoomLevel(m_ZoomLevel * std::pow(0.9f, e.GetYOffset()));
+
+		glm::vec2 after = m_Camera.ScreenToWorld(mousePosition, m_ViewportSize);
+		glm::vec3 position = m_Camera.GetPosition();
+		m_Camera.SetPosition({ position.x + before.x - after.x, position.y + before.y - after.y, position.z });
+		return false;
+	}
+
+	bool OrthographicCameraController::OnWindowResized(WindowResizeEvent& e)
+	{
+		if (e.GetWidth() == 0 || e.GetHeight() == 0)
+			return false;
+
+		m_ViewportSize = { (float)e.GetWidth(), (float)e.GetHeight() };
+		m_AspectRatio = m_ViewportSize.x / m_ViewportSize.y;
+		UpdateProjection();
+		return false;
+	}
+
+	void OrthographicCameraController::UpdateProjection()
+	{
+		m_Camera.SetProjection(-m_AspectRatio * m_ZoomLevel, m_AspectRatio * m_ZoomLevel, -m_ZoomLevel, m_ZoomLevel);
+	}
+
+	PerspectiveCameraController::PerspectiveCameraController(float verticalFov, float aspectRatio, float nearClip, float farClip)
+		: m_ViewportSize(GetWindowSize()), m_Camera(verticalFov, aspectRatio, nearClip, farClip)
+	{
+	}
+
+	void PerspectiveCameraController::OnUpdate(Timestep ts)
+	{
+		glm::vec2 mousePosition = GetMousePosition();
+		if (Input::IsMouseButtonPressed(RM_MOUSE_BUTTON_RIGHT))
+		{
+			if (m_Looking)
+			{
+				glm::vec2 delta = mousePosition - m_LastMousePosition;
+				m_Camera.SetYaw(m_Camera.GetYaw() - delta.x * m_LookSensitivity);
+				m_Camera.SetPitch(m_Camera.GetPitch() - delta.y * m_LookSensitivity);
+			}
+			m_Looking = true;
+		}
+		else
+		{
+			m_Looking = false;
+		}
+		m_LastMousePosition = mousePosition;
+
+		glm::vec3 move(0.0f);
+		if (Input::IsKeyPressed(RM_KEY_W))
+			move += m_Camera.GetForwardDirection();
+		if (Input::IsKeyPressed(RM_KEY_S))
+			move -= m_Camera.GetForwardDirection();
+		if (Input::IsKeyPressed(RM_KEY_D))
+			move += m_Camera.GetRightDirection();
+		if (Input::IsKeyPressed(RM_KEY_A))
+			move -= m_Camera.GetRightDirection();
+		if (Input::IsKeyPressed(RM_KEY_E))
+			move.y += 1.0f;
+		if (Input::IsKeyPressed(RM_KEY_Q))
+			move.y -= 1.0f;
+
+		if (move != glm::vec3(0.0f))
+		{
+			float speed = m_TranslationSpeed * (Input::IsKeyPressed(RM_KEY_LEFT_SHIFT) ? 4.0f : 1.0f);
+			m_Camera.SetPosition(m_Camera.GetPosition() + glm::normalize(move) * (speed * ts));
+		}
+	}
+
+	void PerspectiveCameraController::OnEvent(Event& e)
+	{
+		EventDispatcher dispatcher(e);
+		dispatcher.Dispatch<MouseScrolledEvent>(RM_BIND_EVENT_FN(PerspectiveCameraController::OnMouseScrolled));
+		dispatcher.Dispatch<WindowResizeEvent>(RM_BIND_EVENT_FN(PerspectiveCameraController::OnWindowResized));
+	}
+
+	bool PerspectiveCameraController::OnMouseScrolled(MouseScrolledEvent& e)
+	{
+		glm::vec3 direction = glm::normalize(m_Camera.ScreenToRayDirection(GetMousePosition(), m_ViewportSize));
+		m_Camera.SetPosition(m_Camera.GetPosition() + direction * (e.GetYOffset() * m_DollySpeed));
+		return false;
+	}
+
+	bool PerspectiveCameraController::OnWindowResized(WindowResizeEvent& e)
+	{
+		if (e.GetWidth() == 0 || e.GetHeight() == 0)
+			return false;
+
+		m_ViewportSize = { (float)e.GetWidth(), (float)e.GetHeight() };
+		m_Camera.SetAspectRatio(m_ViewportSize.x / m_ViewportSize.y);
+		return false;
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "RoMan/Renderer/OrthographicCamera.h"
+#include "RoMan/Renderer/PerspectiveCamera.h"
+#include "RoMan/Core/Timestep.h"
+
+#include "RoMan/Events/ApplicationEvent.h"
+#include "RoMan/Events/MouseEvent.h"
+
+namespace RoMan
+{
+	// 2D controller: arrow keys or WASD pan, Q/E rotate (when enabled), middle mouse drags and the
+	// scroll wheel zooms towards the cursor. The view keeps the window's aspect ratio.
+	class OrthographicCameraController
+	{
+	public:
+		OrthographicCameraController(float aspectRatio, bool rotation = false);
+
+		void OnUpdate(Timestep ts);
+		void OnEvent(Event& e);
+
+		OrthographicCamera& GetCamera() { return m_Camera; }
+		const OrthographicCamera& GetCamera() const { return m_Camera; }
+
+		// Half height of the view in world units
+		float GetZoomLevel() const { return m_ZoomLevel; }
+		void SetZoomLevel(float zoomLevel);
+
+	private:
+		bool OnMouseScrolled(MouseScrolledEvent& e);
+		bool OnWindowResized(WindowResizeEvent& e);
+
+		void UpdateProjection();
+
+	private:
+		float m_AspectRatio;
+		float m_ZoomLevel = 1.0f;
+		glm::vec2 m_ViewportSize;
+		OrthographicCamera m_Camera;
+
+		bool m_Rotation;
+		float m_TranslationSpeed = 2.5f;  // View heights per second at zoom level 1
+		float m_RotationSpeed = 90.0f;    // Degrees per second
+
+		bool m_Dragging = false;
+		glm::vec2 m_LastMousePosition;
+	};
+
+	// Fly controller: WASD moves, Q/E moves down/up, shift speeds up, right mouse looks around and
+	// the scroll wheel dollies along the ray under the cursor.
+	class PerspectiveCameraController
+	{
+	public:
+		PerspectiveCameraController(float verticalFov, float aspectRatio, float nearClip = 0.1f, float farClip = 1000.0f);
+
+		void OnUpdate(Timestep ts);
+		void OnEvent(Event& e);
+
+		PerspectiveCamera& GetCamera() { return m_Camera; }
+		const PerspectiveCamera& GetCamera() const { return m_Camera; }
+
+	private:
+		bool OnMouseScrolled(MouseScrolledEvent& e);
+		bool OnWindowResized(WindowResizeEvent& e);
+
+	private:
+		glm::vec2 m_ViewportSize;
+		PerspectiveCamera m_Camera;
+
+		float m_TranslationSpeed = 5.0f;    // World units per second
+		float m_LookSensitivity = 0.15f;    // Degrees per pixel
+		float m_DollySpeed = 1.0f;          // World units per scroll step
+
+		bool m_Looking = false;
+		glm::vec2 m_LastMousePosition;
+	};
+}
@@ -0,0 +1,31 @@
+#include "rmpch.h"
+#include "Framebuffer.h"
+
+#include "Renderer.h"
+#include "RoMan/Core/MemoryTracker.h"
+#include "Platform/OpenGL/OpenGLFramebuffer.h"
+#include "Platform/Null/NullFramebuffer.h"
+
+namespace RoMan
+{
+	Ref<Framebuffer> Framebuffer::Create(const FramebufferSpecification& specification)
+	{
+		RM_MEMORY_SCOPE(MemoryTag::Renderer);
+
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:
+			RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+			return nullptr;
+
+		case RendererAPI::API::OpenGL:
+			return CreateRef<OpenGLFramebuffer>(specification);
+
+		case RendererAPI::API::Null:
+			return CreateRef<NullFramebuffer>(specification);
+		}
+
+		RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+		return nullptr;
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "RoMan/Core.h"
+#include "RoMan/Renderer/RenderHandle.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace RoMan
+{
+	enum class FramebufferTextureFormat
+	{
+		None = 0,
+
+		// Color
+		RGBA8, RGBA16F,
+
+		// Depth and stencil, at most one per framebuffer
+		Depth24Stencil8,
+
+		Depth = Depth24Stencil8
+	};
+
+	static constexpr uint32_t MaxFramebufferSize = 8192;
+
+	struct FramebufferSpecification
+	{
+		// Size on screen, usually the window's
+		uint32_t Width = 0, Height = 0;
+		std::vector<FramebufferTextureFormat> Attachments;
+		uint32_t Samples = 1;
+
+		// The attachments are Width x Height times this. Below 1 renders at a lower internal resolution
+		// and BlitToScreen upscales, trading sharpness for fill rate.
+		float RenderScale = 1.0f;
+
+		uint32_t GetScaledWidth() const { return std::clamp((uint32_t)(Width * RenderScale + 0.5f), 1u, MaxFramebufferSize); }
+		uint32_t GetScaledHeight() const { return std::clamp((uint32_t)(Height * RenderScale + 0.5f), 1u, MaxFramebufferSize); }
+
+		// GPU bytes of all attachments, plus the resolve targets when multisampled
+		uint64_t GetMemorySize() const
+		{
+			uint64_t pixels = (uint64_t)GetScaledWidth() * GetScaledHeight();
+			uint64_t size = 0;
+			for (FramebufferTextureFormat format : Attachments)
+			{
+				uint32_t bytes = format == FramebufferTextureFormat::RGBA16F ? 8 : 4;
+				size += pixels * bytes * Samples;
+				if (Samples > 1 && format != FramebufferTextureFormat::Depth24Stencil8)
+					size += pixels * bytes;
+			}
+			return size;
+		}
+	};
+
+	class Framebuffer : public RefCounted
+	{
+	public:
+		virtual ~Framebuffer() = default;
+
+		// Draws go here until Unbind, the viewport covers the scaled attachments
+		virtual void Bind() = 0;
+		// Back to the window and its viewport. Multisampled attachments are resolved here.
+		virtual void Unbind() = 0;
+
+		// Width and height as on screen, the render scale applies on top. Zero sizes are ignored.
+		virtual void Resize(uint32_t width, uint32_t height) = 0;
+		virtual void SetRenderScale(float scale) = 0;
+
+		// Stretches color attachment 0 over the whole window with linear filtering
+		virtual void BlitToScreen() const = 0;
+
+		// The resolved texture when multisampled
+		virtual TextureHandle GetColorAttachment(uint32_t index = 0) const = 0;
+		virtual void BindColorAttachment(uint32_t index = 0, uint32_t slot = 0) const = 0;
+
+		virtual uint64_t GetMemorySize() const = 0;
+
+		virtual const FramebufferSpecification& GetSpecification() const = 0;
+
+		static Ref<Framebuffer> Create(const FramebufferSpecification& specification);
+	};
+}
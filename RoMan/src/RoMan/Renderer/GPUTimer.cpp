@@ -0,0 +1,28 @@
+#include "rmpch.h"
+#include "GPUTimer.h"
+
+#include "Renderer.h"
+#include "Platform/OpenGL/OpenGLGPUTimer.h"
+#include "Platform/Null/NullGPUTimer.h"
+
+namespace RoMan
+{
+	Ref<GPUTimer> GPUTimer::Create()
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:
+			RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+			return nullptr;
+
+		case RendererAPI::API::OpenGL:
+			return CreateRef<OpenGLGPUTimer>();
+
+		case RendererAPI::API::Null:
+			return CreateRef<NullGPUTimer>();
+		}
+
+		RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+		return nullptr;
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+namespace RoMan
+{
+	// Measures the GPU time of the commands issued between Begin and End. Results arrive a few frames
+	// late and are never waited on, a timer that is read too early keeps its previous value.
+	// Timers can't nest or overlap, only one may be between Begin and End at a time.
+	class GPUTimer : public RefCounted
+	{
+	public:
+		virtual ~GPUTimer() = default;
+
+		virtual void Begin() = 0;
+		virtual void End() = 0;
+
+		// The latest finished measurement, 0 until one is available
+		virtual float GetMilliseconds() const = 0;
+
+		static Ref<GPUTimer> Create();
+	};
+}
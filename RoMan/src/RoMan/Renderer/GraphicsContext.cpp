@@ -0,0 +1,29 @@
+#include "rmpch.h"
+#include "GraphicsContext.h"
+
+#include "Renderer.h"
+#include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/Null/NullContext.h"
+
+namespace RoMan
+{
+	GraphicsContext* GraphicsContext::Create(void* window)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:
+			RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+			return nullptr;
+
+		case RendererAPI::API::OpenGL:
+			return new OpenGLContext(static_cast<GLFWwindow*>(window));
+
+		case RendererAPI::API::Null:
+			return new NullContext();
+
+		}
+
+		RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+		return nullptr;
+	}
+}
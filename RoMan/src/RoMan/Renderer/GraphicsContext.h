@@ -5,7 +5,11 @@ namespace RoMan
 	class GraphicsContext
 	{
 	public:
+		virtual ~GraphicsContext() = default;
+
 		virtual void Init() = 0;
 		virtual void SwapBuffers() = 0;
+
+		static GraphicsContext* Create(void* window);
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "RoMan/Renderer/RenderHandle.h"
+
+#include <vector>
+
+namespace RoMan
+{
+	// Resources of one type stored contiguously and addressed by generational handles.
+	// Freed slots are reused, bumping the generation so stale handles are caught in debug builds.
+	template<typename T, typename THandle>
+	class HandlePool
+	{
+	public:
+		THandle Create(const T& item)
+		{
+			uint32_t index;
+			if (!m_FreeList.empty())
+			{
+				index = m_FreeList.back();
+				m_FreeList.pop_back();
+				m_Items[index] = item;
+			}
+			else
+			{
+				index = (uint32_t)m_Items.size();
+				RM_CORE_ASSERT(index < THandle::IndexMask, "HandlePool is full!");
+				m_Items.push_back(item);
+				m_Generations.push_back(0);
+			}
+
+			m_Alive++;
+			return THandle::Make(index, m_Generations[index]);
+		}
+
+		void Destroy(THandle handle)
+		{
+			RM_CORE_ASSERT(IsValid(handle), "Destroying a stale handle!");
+
+			uint32_t index = handle.GetIndex();
+			m_Generations[index] = (m_Generations[index] + 1) & THandle::GenerationMask;
+			m_Items[index] = T();
+			m_FreeList.push_back(index);
+			m_Alive--;
+		}
+
+		bool IsValid(THandle handle) const
+		{
+			return handle.IsValid() && handle.GetIndex() < m_Items.size()
+				&& m_Generations[handle.GetIndex()] == handle.GetGeneration();
+		}
+
+		T& Get(THandle handle)
+		{
+			RM_CORE_ASSERT(IsValid(handle), "Stale or invalid handle!");
+			return m_Items[handle.GetIndex()];
+		}
+
+		const T& Get(THandle handle) const
+		{
+			RM_CORE_ASSERT(IsValid(handle), "Stale or invalid handle!");
+			return m_Items[handle.GetIndex()];
+		}
+
+		uint32_t GetAliveCount() const { return m_Alive; }
+
+	private:
+		std::vector<T> m_Items;
+		std::vector<uint32_t> m_Generations;
+		std::vector<uint32_t> m_FreeList;
+		uint32_t m_Alive = 0;
+	};
+}
@@ -5,18 +5,72 @@
 
 namespace RoMan
 {
-	OrthographicCamera::OrthographicCamera(float left, float right, float bottom, float top)
-		:m_ProjectionMatrix(glm::ortho(left, right, bottom, top, -1.0f, 1.0f)), m_ViewMatrix(1.0f)
+	OrthographicCamera::OrthographicCamera(float left, float right, float bottom, float top, float nearClip, float farClip)
+		: m_Left(left), m_Right(right), m_Bottom(bottom), m_Top(top), m_Near(nearClip), m_Far(farClip)
 	{
-		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
 	}
-	void OrthographicCamera::RecalculateViewMatrix()
+
+	void OrthographicCamera::SetProjection(float left, float right, float bottom, float top)
+	{
+		SetProjection(left, right, bottom, top, m_Near, m_Far);
+	}
+
+	void OrthographicCamera::SetProjection(float left, float right, float bottom, float top, float nearClip, float farClip)
+	{
+		m_Left = left;
+		m_Right = right;
+		m_Bottom = bottom;
+		m_Top = top;
+		m_Near = nearClip;
+		m_Far = farClip;
+		InvalidateProjection();
+	}
+
+	glm::mat4 OrthographicCamera::CalculateProjectionMatrix() const
+	{
+		return glm::ortho(m_Left, m_Right, m_Bottom, m_Top, m_Near, m_Far);
+	}
+
+	glm::mat4 OrthographicCamera::CalculateViewMatrix() const
 	{
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), m_Position) *
-			glm::rotate(glm::mat4(1.0f), glm::radians(m_Rotation), glm::vec3(0, 0, 1));
+		// Inverse of translate * rotateZ: the transposed rotation followed by the negated translation
+		float cosine = std::cos(glm::radians(m_Rotation));
+		float sine = std::sin(glm::radians(m_Rotation));
 
-		m_ViewMatrix = glm::inverse(transform);
+		glm::mat4 view(1.0f);
+		view[0][0] = cosine;
+		view[0][1] = -sine;
+		view[1][0] = sine;
+		view[1][1] = cosine;
+		view[3][0] = -(cosine * m_Position.x + sine * m_Position.y);
+		view[3][1] = sine * m_Position.x - cosine * m_Position.y;
+		view[3][2] = -m_Position.z;
+		return view;
+	}
+
+	AABB OrthographicCamera::GetBounds() const
+	{
+		glm::vec3 halfSize((m_Right - m_Left) * 0.5f, (m_Top - m_Bottom) * 0.5f, (m_Far - m_Near) * 0.5f);
+		glm::vec3 offset((m_Right + m_Left) * 0.5f, (m_Top + m_Bottom) * 0.5f, -(m_Far + m_Near) * 0.5f);
+
+		float cosine = std::cos(glm::radians(m_Rotation));
+		float sine = std::sin(glm::radians(m_Rotation));
+
+		glm::vec3 center = m_Position + glm::vec3(cosine * offset.x - sine * offset.y, sine * offset.x + cosine * offset.y, offset.z);
+		glm::vec3 extents(std::fabs(cosine) * halfSize.x + std::fabs(sine) * halfSize.y,
+			std::fabs(sine) * halfSize.x + std::fabs(cosine) * halfSize.y, halfSize.z);
+
+		return AABB(center - extents, center + extents);
+	}
+
+	glm::vec2 OrthographicCamera::ScreenToWorld(const glm::vec2& screenPosition, const glm::vec2& viewportSize) const
+	{
+		float u = screenPosition.x / viewportSize.x;
+		float v = 1.0f - screenPosition.y / viewportSize.y;
+		glm::vec2 view(m_Left + u * (m_Right - m_Left), m_Bottom + v * (m_Top - m_Bottom));
 
-		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		float cosine = std::cos(glm::radians(m_Rotation));
+		float sine = std::sin(glm::radians(m_Rotation));
+		return { m_Position.x + cosine * view.x - sine * view.y, m_Position.y + sine * view.x + cosine * view.y };
 	}
-}
\ No newline at end of file
+}
@@ -1,31 +1,32 @@
 #pragma once
-#include "glm/glm.hpp"
+#include "RoMan/Renderer/Camera.h"
 
 namespace RoMan
 {
-	class OrthographicCamera
+	class OrthographicCamera : public Camera
 	{
 	public:
-		OrthographicCamera(float left, float right, float bottom, float top);
+		OrthographicCamera(float left, float right, float bottom, float top, float nearClip = -1.0f, float farClip = 1.0f);
 
-		const glm::vec3& GetPosition() { return m_Position; }
-		void SetPosition(const glm::vec3& position) { m_Position = position; RecalculateViewMatrix(); }
+		void SetProjection(float left, float right, float bottom, float top);
+		void SetProjection(float left, float right, float bottom, float top, float nearClip, float farClip);
 
-		const glm::float32 GetRotation() { return m_Rotation; }
-		void SetRotation(float rotation) { m_Rotation = rotation; RecalculateViewMatrix(); }
+		// Degrees around Z
+		float GetRotation() const { return m_Rotation; }
+		void SetRotation(float rotation) { m_Rotation = rotation; InvalidateView(); }
 
-		const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
-		const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
-		const glm::mat4& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; }
+		// World space box around the visible area, rotated views give the box around the rotated rectangle
+		AABB GetBounds() const override;
+		// Window position in pixels (origin top left, e.g. from Input::GetMousePosition) to world space
+		glm::vec2 ScreenToWorld(const glm::vec2& screenPosition, const glm::vec2& viewportSize) const;
 
-	private:
-		void RecalculateViewMatrix();
-	private:
-		glm::mat4 m_ProjectionMatrix;
-		glm::mat4 m_ViewMatrix;
-		glm::mat4 m_ViewProjectionMatrix;
+	protected:
+		glm::mat4 CalculateProjectionMatrix() const override;
+		glm::mat4 CalculateViewMatrix() const override;
 
-		glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
+	private:
+		float m_Left, m_Right, m_Bottom, m_Top;
+		float m_Near, m_Far;
 		float m_Rotation = 0.0f;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,108 @@
+#include "rmpch.h"
+#include "PerspectiveCamera.h"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+namespace RoMan
+{
+	PerspectiveCamera::PerspectiveCamera(float verticalFov, float aspectRatio, float nearClip, float farClip)
+		: m_VerticalFov(verticalFov), m_AspectRatio(aspectRatio), m_Near(nearClip), m_Far(farClip)
+	{
+	}
+
+	void PerspectiveCamera::SetProjection(float verticalFov, float aspectRatio, float nearClip, float farClip)
+	{
+		m_VerticalFov = verticalFov;
+		m_AspectRatio = aspectRatio;
+		m_Near = nearClip;
+		m_Far = farClip;
+		InvalidateProjection();
+	}
+
+	void PerspectiveCamera::SetPitch(float pitch)
+	{
+		m_Pitch = std::max(-89.0f, std::min(pitch, 89.0f));
+		InvalidateView();
+	}
+
+	glm::vec3 PerspectiveCamera::GetForwardDirection() const
+	{
+		float yaw = glm::radians(m_Yaw), pitch = glm::radians(m_Pitch);
+		return { -std::sin(yaw) * std::cos(pitch), std::sin(pitch), -std::cos(yaw) * std::cos(pitch) };
+	}
+
+	glm::vec3 PerspectiveCamera::GetRightDirection() const
+	{
+		float yaw = glm::radians(m_Yaw);
+		return { std::cos(yaw), 0.0f, -std::sin(yaw) };
+	}
+
+	glm::vec3 PerspectiveCamera::GetUpDirection() const
+	{
+		// cross(right, forward), expanded
+		float yaw = glm::radians(m_Yaw), pitch = glm::radians(m_Pitch);
+		return { std::sin(yaw) * std::sin(pitch), std::cos(pitch), std::cos(yaw) * std::sin(pitch) };
+	}
+
+	glm::mat4 PerspectiveCamera::CalculateProjectionMatrix() const
+	{
+		return glm::perspective(glm::radians(m_VerticalFov), m_AspectRatio, m_Near, m_Far);
+	}
+
+	glm::mat4 PerspectiveCamera::CalculateViewMatrix() const
+	{
+		// The camera basis is orthonormal, so the inverse of its rotation is the transpose
+		glm::vec3 right = GetRightDirection();
+		glm::vec3 up = GetUpDirection();
+		glm::vec3 forward = GetForwardDirection();
+
+		glm::mat4 view(1.0f);
+		view[0][0] = right.x;
+		view[1][0] = right.y;
+		view[2][0] = right.z;
+		view[0][1] = up.x;
+		view[1][1] = up.y;
+		view[2][1] = up.z;
+		view[0][2] = -forward.x;
+		view[1][2] = -forward.y;
+		view[2][2] = -forward.z;
+		view[3][0] = -glm::dot(right, m_Position);
+		view[3][1] = -glm::dot(up, m_Position);
+		view[3][2] = glm::dot(forward, m_Position);
+		return view;
+	}
+
+	AABB PerspectiveCamera::GetBounds() const
+	{
+		glm::vec3 right = GetRightDirection();
+		glm::vec3 up = GetUpDirection();
+		glm::vec3 forward = GetForwardDirection();
+		float tanHalfFov = std::tan(glm::radians(m_VerticalFov) * 0.5f);
+
+		glm::vec3 min(std::numeric_limits<float>::max());
+		glm::vec3 max(std::numeric_limits<float>::lowest());
+		for (float distance : { m_Near, m_Far })
+		{
+			glm::vec3 center = m_Position + forward * distance;
+			glm::vec3 halfUp = up * (distance * tanHalfFov);
+			glm::vec3 halfRight = right * (distance * tanHalfFov * m_AspectRatio);
+
+			for (glm::vec3 corner : { center - halfRight - halfUp, center + halfRight - halfUp, center + halfRight + halfUp, center - halfRight + halfUp })
+			{
+				min = glm::min(min, corner);
+				max = glm::max(max, corner);
+			}
+		}
+
+		return AABB(min, max);
+	}
+
+	glm::vec3 PerspectiveCamera::ScreenToRayDirection(const glm::vec2& screenPosition, const glm::vec2& viewportSize) const
+	{
+		float ndcX = screenPosition.x / viewportSize.x * 2.0f - 1.0f;
+		float ndcY = 1.0f - screenPosition.y / viewportSize.y * 2.0f;
+		float tanHalfFov = std::tan(glm::radians(m_VerticalFov) * 0.5f);
+
+		return GetForwardDirection() + GetRightDirection() * (ndcX * tanHalfFov * m_AspectRatio) + GetUpDirection() * (ndcY * tanHalfFov);
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "RoMan/Renderer/Camera.h"
+
+namespace RoMan
+{
+	// Yaw turns around +Y and pitch around the camera's right axis, both in degrees. At zero the
+	// camera looks down -Z with +Y up.
+	class PerspectiveCamera : public Camera
+	{
+	public:
+		PerspectiveCamera(float verticalFov, float aspectRatio, float nearClip = 0.1f, float farClip = 1000.0f);
+
+		void SetProjection(float verticalFov, float aspectRatio, float nearClip, float farClip);
+		void SetAspectRatio(float aspectRatio) { m_AspectRatio = aspectRatio; InvalidateProjection(); }
+		void SetVerticalFov(float verticalFov) { m_VerticalFov = verticalFov; InvalidateProjection(); }
+
+		float GetVerticalFov() const { return m_VerticalFov; }
+		float GetAspectRatio() const { return m_AspectRatio; }
+		float GetNearClip() const { return m_Near; }
+		float GetFarClip() const { return m_Far; }
+
+		float GetYaw() const { return m_Yaw; }
+		float GetPitch() const { return m_Pitch; }
+		void SetYaw(float yaw) { m_Yaw = yaw; InvalidateView(); }
+		// Clamped just short of straight up/down
+		void SetPitch(float pitch);
+
+		glm::vec3 GetForwardDirection() const;
+		glm::vec3 GetRightDirection() const;
+		glm::vec3 GetUpDirection() const;
+
+		AABB GetBounds() const override;
+		// Direction of the ray from the camera through a window position in pixels, not normalized
+		glm::vec3 ScreenToRayDirection(const glm::vec2& screenPosition, const glm::vec2& viewportSize) const;
+
+	protected:
+		glm::mat4 CalculateProjectionMatrix() const override;
+		glm::mat4 CalculateViewMatrix() const override;
+
+	private:
+		float m_VerticalFov, m_AspectRatio;
+		float m_Near, m_Far;
+		float m_Yaw = 0.0f, m_Pitch = 0.0f;
+	};
+}
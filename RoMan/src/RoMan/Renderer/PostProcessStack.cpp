@@ -0,0 +1,113 @@
+#include "rmpch.h"
+#include "PostProcessStack.h"
+
+#include "RenderCommand.h"
+#include "RoMan/Core/MemoryTracker.h"
+
+
+namespace RoMan
+{
+	PostProcessStack::PostProcessStack()
+	{
+		RM_MEMORY_SCOPE(MemoryTag::Renderer);
+
+		m_FullscreenQuad.reset(VertexArray::Create());
+
+		float vertices[4 * 4] = {
+			-1.0f, -1.0f, 0.0f, 0.0f,
+			 1.0f, -1.0f, 1.0f, 0.0f,
+			 1.0f,  1.0f, 1.0f, 1.0f,
+			-1.0f,  1.0f, 0.0f, 1.0f
+		};
+		Ref<VertexBuffer> vertexBuffer;
+		vertexBuffer.reset(VertexBuffer::Create(vertices, sizeof(vertices)));
+		vertexBuffer->SetLayout({
+				{ ShaderDataType::Float2, "a_Position" },
+				{ ShaderDataType::Float2, "a_TexCoord" }
+			});
+		m_FullscreenQuad->AddVertexBuffer(vertexBuffer);
+
+		uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+		Ref<IndexBuffer> indexBuffer;
+		indexBuffer.reset(IndexBuffer::Create(indices, sizeof(indices) / sizeof(uint32_t)));
+		m_FullscreenQuad->SetIndexBuffer(indexBuffer);
+	}
+
+	uint32_t PostProcessStack::AddPass(const PostProcessPass& pass)
+	{
+		RM_CORE_ASSERT(pass.PassShader, "Post process pass has no shader!");
+
+		m_Passes.push_back(pass);
+		m_Timers.push_back(GPUTimer::Create());
+		return (uint32_t)m_Passes.size() - 1;
+	}
+
+	void PostProcessStack::Render(const Ref<Framebuffer>& input)
+	{
+		uint32_t width = input->GetSpecification().GetScaledWidth();
+		uint32_t height = input->GetSpecification().GetScaledHeight();
+
+		m_Graph.Reset();
+		m_Scene = m_Graph.Import("Scene", input);
+
+		RenderGraphResource source = m_Scene;
+		m_PassSources.resize(m_Passes.size());
+		for (uint32_t i = 0; i < (uint32_t)m_Passes.size(); i++)
+		{
+			const PostProcessPass& pass = m_Passes[i];
+			if (!pass.Enabled)
+				continue;
+
+			uint32_t divisor = (uint32_t)pass.Resolution;
+			RenderGraphResource target = RenderGraph::Invalid;
+			m_PassSources[i] = source;
+			m_Graph.AddPass(pass.Name, [&](RenderGraphBuilder& builder)
+				{
+					builder.Read(source);
+					if (pass.ReadsScene)
+						builder.Read(m_Scene);
+					target = builder.Create(pass.Name, { std::max(width / divisor, 1u), std::max(height / divisor, 1u), pass.Format });
+				},
+				[this, i](const RenderGraph& graph) { ExecutePass(i, graph); });
+
+			source = target;
+		}
+
+		m_Graph.AddPass("Present", [&](RenderGraphBuilder& builder)
+			{
+				builder.Read(source);
+				builder.SetSideEffect();
+			},
+			[source](const RenderGraph& graph) { graph.GetFramebuffer(source)->BlitToScreen(); });
+
+		m_Graph.Compile();
+		m_Graph.Execute();
+	}
+
+	void PostProcessStack::ExecutePass(uint32_t index, const RenderGraph& graph)
+	{
+		const PostProcessPass& pass = m_Passes[index];
+		RenderGraphResource source = m_PassSources[index];
+		const FramebufferSpecification& sourceSpecification = graph.GetFramebuffer(source)->GetSpecification();
+		glm::vec2 texelSize = { 1.0f / sourceSpecification.GetScaledWidth(), 1.0f / sourceSpecification.GetScaledHeight() };
+
+		m_Timers[index]->Begin();
+
+		Shader& shader = *pass.PassShader;
+		shader.Bind();
+		graph.BindTexture(source, 0);
+		shader.SetInt("u_Texture", 0);
+		shader.SetFloat2("u_TexelSize", texelSize);
+		if (pass.ReadsScene)
+		{
+			graph.BindTexture(m_Scene, 1);
+			shader.SetInt("u_Scene", 1);
+		}
+		if (pass.SetUniforms)
+			pass.SetUniforms(shader);
+
+		RenderCommand::DrawIndexed(m_FullscreenQuad);
+
+		m_Timers[index]->End();
+	}
+}
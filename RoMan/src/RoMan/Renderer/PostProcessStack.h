@@ -0,0 +1,73 @@
+#pragma once
+
+#include "RoMan/Renderer/Framebuffer.h"
+#include "RoMan/Renderer/GPUTimer.h"
+#include "RoMan/Renderer/RenderGraph.h"
+#include "RoMan/Renderer/Shader.h"
+#include "RoMan/Renderer/VertexArray.h"
+
+#include <functional>
+
+namespace RoMan
+{
+	// Fraction of the input's size a pass renders at
+	enum class PostProcessResolution
+	{
+		Full = 1, Half = 2, Quarter = 4
+	};
+
+	// One fullscreen draw. The shader's vertex stage takes a_Position (vec2) and a_TexCoord (vec2),
+	// it samples the previous pass's output from u_Texture and gets that texture's u_TexelSize.
+	// Passes write every pixel with alpha 1, targets aren't cleared.
+	struct PostProcessPass
+	{
+		std::string Name;
+		Ref<Shader> PassShader;
+		PostProcessResolution Resolution = PostProcessResolution::Full;
+		FramebufferTextureFormat Format = FramebufferTextureFormat::RGBA8;
+
+		// Also binds the stack's input to u_Scene, for passes that combine their chain with the scene
+		bool ReadsScene = false;
+		bool Enabled = true;
+
+		// Sets the pass's own uniforms and textures, the shader is already bound.
+		// Slots 0 and 1 belong to u_Texture and u_Scene.
+		std::function<void(Shader&)> SetUniforms;
+	};
+
+	// Runs a chain of passes over a rendered scene and puts the result on screen. The chain is built
+	// into a RenderGraph every frame, so a pass writes into whatever the pass before the previous one
+	// released and a chain only holds two targets per size at a time.
+	class PostProcessStack
+	{
+	public:
+		PostProcessStack();
+
+		// Passes run in the order they are added, returns the pass's index
+		uint32_t AddPass(const PostProcessPass& pass);
+		PostProcessPass& GetPass(uint32_t index) { return m_Passes[index]; }
+		uint32_t GetPassCount() const { return (uint32_t)m_Passes.size(); }
+
+		// GPU time of the pass a few frames ago
+		float GetPassTime(uint32_t index) const { return m_Timers[index]->GetMilliseconds(); }
+
+		// Runs the enabled passes over color attachment 0 of input, which must not be bound,
+		// and blits the last output to the screen. With no passes enabled the input is blitted.
+		void Render(const Ref<Framebuffer>& input);
+
+		const RenderGraph& GetGraph() const { return m_Graph; }
+
+	private:
+		void ExecutePass(uint32_t index, const RenderGraph& graph);
+
+	private:
+		std::vector<PostProcessPass> m_Passes;
+		std::vector<Ref<GPUTimer>> m_Timers;
+		// What each pass reads in the graph being built, so execute callbacks only capture the index
+		std::vector<RenderGraphResource> m_PassSources;
+		RenderGraphResource m_Scene = RenderGraph::Invalid;
+
+		RenderGraph m_Graph;
+		Ref<VertexArray> m_FullscreenQuad;
+	};
+}
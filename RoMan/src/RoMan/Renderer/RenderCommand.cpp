@@ -1,9 +1,7 @@
 #include "rmpch.h"
 #include "RenderCommand.h"
 
-#include "Platform/OpenGL/OpenGLRendererAPI.h"
-
 namespace RoMan
 {
-	RendererAPI* RenderCommand::s_RendererAPI = new OpenGLRendererAPI;
-}
\ No newline at end of file
+	RendererAPI* RenderCommand::s_RendererAPI = nullptr;
+}
@@ -1,6 +1,8 @@
 #pragma once
 #include "RendererAPI.h"
 
+#include "RoMan/Core/FrameStats.h"
+
 namespace RoMan
 {
 	class RenderCommand
@@ -9,9 +11,15 @@ namespace RoMan
 
 		inline static void Init()
 		{
+			s_RendererAPI = RendererAPI::Create();
 			s_RendererAPI->Init();
 		}
 
+		inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+		{
+			s_RendererAPI->SetViewport(x, y, width, height);
+		}
+
 		inline static void SetClearColor(const glm::vec4& color)
 		{
 			s_RendererAPI->SetClearColor(color);
@@ -22,9 +30,15 @@ namespace RoMan
 			s_RendererAPI->Clear();
 		}
 
-		inline static void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray)
+		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray)
+		{
+			DrawIndexed({ vertexArray->GetHandle(), vertexArray->GetIndexBuffer()->GetCount() });
+		}
+
+		inline static void DrawIndexed(const DrawIndexedCommand& command)
 		{
-			s_RendererAPI->DrawIndexed(vertexArray);
+			s_RendererAPI->DrawIndexed(command);
+			FrameStats::RecordDrawCall(command.IndexCount);
 		}
 
 	private:
@@ -0,0 +1,272 @@
+#include "rmpch.h"
+#include "RenderGraph.h"
+
+namespace RoMan
+{
+	static void AddUnique(FrameVector<uint32_t>& passes, uint32_t pass)
+	{
+		if (std::find(passes.begin(), passes.end(), pass) == passes.end())
+			passes.push_back(pass);
+	}
+
+	RenderGraphResource RenderGraphBuilder::Create(const std::string& name, const RenderGraphTextureDesc& desc)
+	{
+		RM_CORE_ASSERT(desc.Width > 0 && desc.Height > 0, "Render graph texture has no size!");
+
+		RenderGraph::Resource& resource = m_Graph.m_Resources.emplace_back();
+		resource.Name = name;
+		resource.Desc = desc;
+
+		RenderGraphResource handle = (RenderGraphResource)m_Graph.m_Resources.size() - 1;
+		RenderGraph::Pass& pass = m_Graph.m_Passes[m_Pass];
+		RM_CORE_ASSERT(pass.Output == RenderGraph::Invalid, "Render graph pass writes more than one texture!");
+		pass.Output = handle;
+		resource.Writer = m_Pass;
+		return handle;
+	}
+
+	void RenderGraphBuilder::Read(RenderGraphResource resource)
+	{
+		RM_CORE_ASSERT(resource < m_Graph.m_Resources.size(), "Unknown render graph texture!");
+
+		RenderGraph::Resource& declared = m_Graph.m_Resources[resource];
+		RM_CORE_ASSERT(declared.Imported || declared.Writer != RenderGraph::Invalid, "Render graph texture is read before it is written!");
+
+		m_Graph.m_Passes[m_Pass].Reads.push_back(resource);
+		if (declared.Writer != RenderGraph::Invalid)
+			m_Graph.AddDependency(m_Pass, declared.Writer);
+		declared.Readers.push_back(m_Pass);
+	}
+
+	void RenderGraphBuilder::Write(RenderGraphResource resource)
+	{
+		RM_CORE_ASSERT(resource < m_Graph.m_Resources.size(), "Unknown render graph texture!");
+
+		RenderGraph::Resource& declared = m_Graph.m_Resources[resource];
+		RM_CORE_ASSERT(declared.Imported, "Transient textures are only written by the pass that created them!");
+
+		RenderGraph::Pass& pass = m_Graph.m_Passes[m_Pass];
+		RM_CORE_ASSERT(pass.Output == RenderGraph::Invalid, "Render graph pass writes more than one texture!");
+		pass.Output = resource;
+
+		// Runs after the previous write and everything that read it. Those readers only constrain the
+		// order, they are still culled if nothing uses what they produce.
+		if (declared.Writer != RenderGraph::Invalid)
+			m_Graph.AddDependency(m_Pass, declared.Writer);
+		for (uint32_t reader : declared.Readers)
+		{
+			if (reader != m_Pass)
+				AddUnique(pass.After, reader);
+		}
+
+		declared.Writer = m_Pass;
+		declared.Readers.clear();
+	}
+
+	void RenderGraphBuilder::SetSideEffect()
+	{
+		m_Graph.m_Passes[m_Pass].SideEffect = true;
+	}
+
+	void RenderGraph::AddPass(const std::string& name, const SetupFn& setup, const ExecuteFn& execute)
+	{
+		RM_CORE_ASSERT(!m_Compiled, "Render graph is already compiled, Reset it first!");
+
+		Pass& pass = m_Passes.emplace_back();
+		pass.Name = name;
+		pass.Execute = execute;
+
+		RenderGraphBuilder builder(*this, (uint32_t)m_Passes.size() - 1);
+		setup(builder);
+	}
+
+	RenderGraphResource RenderGraph::Import(const std::string& name, const Ref<Framebuffer>& framebuffer)
+	{
+		RM_CORE_ASSERT(framebuffer, "Imported framebuffer is null!");
+
+		Resource& resource = m_Resources.emplace_back();
+		resource.Name = name;
+		resource.Imported = framebuffer;
+		resource.Desc = { framebuffer->GetSpecification().GetScaledWidth(), framebuffer->GetSpecification().GetScaledHeight() };
+		return (RenderGraphResource)m_Resources.size() - 1;
+	}
+
+	void RenderGraph::AddDependency(uint32_t pass, uint32_t dependency)
+	{
+		if (pass != dependency)
+			AddUnique(m_Passes[pass].Dependencies, dependency);
+	}
+
+	void RenderGraph::MarkLive(uint32_t pass, FrameVector<uint8_t>& live)
+	{
+		if (live[pass])
+			return;
+
+		live[pass] = 1;
+		for (uint32_t dependency : m_Passes[pass].Dependencies)
+			MarkLive(dependency, live);
+	}
+
+	void RenderGraph::Visit(uint32_t pass, const FrameVector<uint8_t>& live, FrameVector<uint8_t>& state)
+	{
+		if (state[pass] == 2)
+			return;
+
+		RM_CORE_ASSERT(state[pass] == 0, "Render graph has a cycle!");
+		state[pass] = 1;
+		for (uint32_t dependency : m_Passes[pass].Dependencies)
+			Visit(dependency, live, state);
+		for (uint32_t earlier : m_Passes[pass].After)
+		{
+			if (live[earlier])
+				Visit(earlier, live, state);
+		}
+		state[pass] = 2;
+
+		m_Order.push_back(pass);
+	}
+
+	void RenderGraph::Compile()
+	{
+		RM_CORE_ASSERT(!m_Compiled, "Render graph is already compiled!");
+
+		// Passes with visible results and whatever they read from are kept, the rest is culled. Then
+		// depth first from the same roots, so every producer lands right before its consumer and
+		// transients die early and can be shared.
+		auto isRoot = [this](const Pass& pass)
+		{
+			return pass.SideEffect || (pass.Output != Invalid && m_Resources[pass.Output].Imported);
+		};
+
+		FrameVector<uint8_t> live(m_Passes.size(), 0);
+		for (uint32_t i = 0; i < (uint32_t)m_Passes.size(); i++)
+		{
+			if (isRoot(m_Passes[i]))
+				MarkLive(i, live);
+		}
+
+		FrameVector<uint8_t> state(m_Passes.size(), 0);
+		for (uint32_t i = 0; i < (uint32_t)m_Passes.size(); i++)
+		{
+			if (isRoot(m_Passes[i]))
+				Visit(i, live, state);
+		}
+
+		for (uint32_t position = 0; position < (uint32_t)m_Order.size(); position++)
+		{
+			const Pass& pass = m_Passes[m_Order[position]];
+			if (pass.Output != Invalid)
+			{
+				Resource& output = m_Resources[pass.Output];
+				output.FirstUse = std::min(output.FirstUse, position);
+				output.LastUse = position;
+			}
+			for (RenderGraphResource read : pass.Reads)
+				m_Resources[read].LastUse = position;
+		}
+
+		// A transient takes a free framebuffer of its size and format, it frees it after its last use.
+		// Outputs are placed before reads are freed, a pass never writes what it samples.
+		m_Stats = {};
+		for (uint32_t position = 0; position < (uint32_t)m_Order.size(); position++)
+		{
+			const Pass& pass = m_Passes[m_Order[position]];
+			if (pass.Output != Invalid && !m_Resources[pass.Output].Imported)
+			{
+				Resource& output = m_Resources[pass.Output];
+				for (uint32_t i = 0; i < (uint32_t)m_Physical.size() && output.Physical == Invalid; i++)
+				{
+					if (m_Physical[i].Free && m_Physical[i].Desc == output.Desc)
+					{
+						m_Physical[i].Free = false;
+						output.Physical = i;
+					}
+				}
+
+				if (output.Physical == Invalid)
+				{
+					m_Physical.push_back({ output.Desc });
+					output.Physical = (uint32_t)m_Physical.size() - 1;
+					m_Stats.AliasedMemory += output.Desc.GetMemorySize();
+				}
+
+				m_Stats.Transients++;
+				m_Stats.UnaliasedMemory += output.Desc.GetMemorySize();
+			}
+
+			auto release = [this, position](RenderGraphResource handle)
+			{
+				const Resource& resource = m_Resources[handle];
+				if (resource.Physical != Invalid && resource.LastUse == position)
+					m_Physical[resource.Physical].Free = true;
+			};
+
+			if (pass.Output != Invalid)
+				release(pass.Output);
+			for (RenderGraphResource read : pass.Reads)
+				release(read);
+		}
+
+		m_Stats.Passes = (uint32_t)m_Passes.size();
+		m_Stats.CulledPasses = (uint32_t)(m_Passes.size() - m_Order.size());
+		m_Stats.PhysicalTargets = (uint32_t)m_Physical.size();
+		m_Compiled = true;
+	}
+
+	void RenderGraph::Execute()
+	{
+		RM_CORE_ASSERT(m_Compiled, "Render graph must be compiled before it executes!");
+
+		for (PhysicalTarget& physical : m_Physical)
+			physical.Target = m_Targets.Acquire(physical.Desc.Width, physical.Desc.Height, physical.Desc.Format);
+
+		for (uint32_t index : m_Order)
+		{
+			const Pass& pass = m_Passes[index];
+			if (pass.Output == Invalid)
+			{
+				pass.Execute(*this);
+				continue;
+			}
+
+			const Ref<Framebuffer>& target = GetFramebuffer(pass.Output);
+			target->Bind();
+			pass.Execute(*this);
+			target->Unbind();
+		}
+
+		for (PhysicalTarget& physical : m_Physical)
+		{
+			m_Targets.Release(physical.Target);
+			physical.Target = nullptr;
+		}
+
+		m_Targets.EndFrame();
+	}
+
+	void RenderGraph::Reset()
+	{
+		m_Passes.clear();
+		m_Resources.clear();
+		m_Order.clear();
+		m_Physical.clear();
+		m_Compiled = false;
+	}
+
+	const Ref<Framebuffer>& RenderGraph::GetFramebuffer(RenderGraphResource resource) const
+	{
+		RM_CORE_ASSERT(resource < m_Resources.size(), "Unknown render graph texture!");
+
+		const Resource& declared = m_Resources[resource];
+		if (declared.Imported)
+			return declared.Imported;
+
+		RM_CORE_ASSERT(declared.Physical != Invalid && m_Physical[declared.Physical].Target, "Render graph texture is not allocated, it was culled or the graph isn't executing!");
+		return m_Physical[declared.Physical].Target;
+	}
+
+	void RenderGraph::BindTexture(RenderGraphResource resource, uint32_t slot) const
+	{
+		GetFramebuffer(resource)->BindColorAttachment(0, slot);
+	}
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Renderer/Framebuffer.h"
+#include "RoMan/Renderer/RenderTargetPool.h"
+
+#include <functional>
+
+namespace RoMan
+{
+	// A texture of the graph being built, valid until the graph is reset
+	using RenderGraphResource = uint32_t;
+
+	struct RenderGraphTextureDesc
+	{
+		uint32_t Width = 0, Height = 0;
+		FramebufferTextureFormat Format = FramebufferTextureFormat::RGBA8;
+
+		uint64_t GetMemorySize() const { return (uint64_t)Width * Height * (Format == FramebufferTextureFormat::RGBA16F ? 8 : 4); }
+
+		bool operator==(const RenderGraphTextureDesc& other) const { return Width == other.Width && Height == other.Height && Format == other.Format; }
+		bool operator!=(const RenderGraphTextureDesc& other) const { return !(*this == other); }
+	};
+
+	struct RenderGraphStats
+	{
+		uint32_t Passes = 0;
+		uint32_t CulledPasses = 0;
+		uint32_t Transients = 0;
+		// Framebuffers the transients were packed into
+		uint32_t PhysicalTargets = 0;
+
+		// Transient bytes if each had its own framebuffer, and with the ones that don't overlap sharing
+		uint64_t UnaliasedMemory = 0;
+		uint64_t AliasedMemory = 0;
+	};
+
+	class RenderGraph;
+
+	// Handed to a pass's setup to declare the textures it uses
+	class RenderGraphBuilder
+	{
+	public:
+		// A transient texture this pass writes. It is alive from this pass until its last reader.
+		RenderGraphResource Create(const std::string& name, const RenderGraphTextureDesc& desc);
+		void Read(RenderGraphResource resource);
+		// For imported textures, a transient is only written by the pass that created it
+		void Write(RenderGraphResource resource);
+
+		// Keeps the pass although nothing reads what it writes, e.g. it draws to the screen
+		void SetSideEffect();
+
+	private:
+		RenderGraphBuilder(RenderGraph& graph, uint32_t pass)
+			:m_Graph(graph), m_Pass(pass) {}
+
+	private:
+		RenderGraph& m_Graph;
+		uint32_t m_Pass;
+
+		friend class RenderGraph;
+	};
+
+	// One frame of passes. Passes declare what they read and write, Compile drops the ones nothing
+	// depends on, orders the rest so textures are produced right before they are consumed, and packs
+	// transients whose lifetimes don't overlap into the same framebuffers.
+	// Rebuild it every frame: Reset, AddPass..., Compile, Execute. Per pass lists live in the
+	// FrameAllocator, so a graph must be reset before it is built again in a later frame.
+	class RenderGraph
+	{
+	public:
+		static constexpr uint32_t Invalid = ~0u;
+
+		using SetupFn = std::function<void(RenderGraphBuilder&)>;
+		using ExecuteFn = std::function<void(const RenderGraph&)>;
+
+		// Setup runs right away, execute runs in Execute unless the pass was culled.
+		// A pass writes at most one texture, which is bound while it executes.
+		void AddPass(const std::string& name, const SetupFn& setup, const ExecuteFn& execute);
+		// A framebuffer owned elsewhere, like the scene. Only color attachment 0 is used.
+		RenderGraphResource Import(const std::string& name, const Ref<Framebuffer>& framebuffer);
+
+		void Compile();
+		void Execute();
+		// Drops the passes and textures, the framebuffers stay pooled for the next frame
+		void Reset();
+
+		const Ref<Framebuffer>& GetFramebuffer(RenderGraphResource resource) const;
+		void BindTexture(RenderGraphResource resource, uint32_t slot) const;
+
+		// Of the last Compile
+		const RenderGraphStats& GetStats() const { return m_Stats; }
+		const RenderTargetPool& GetTargetPool() const { return m_Targets; }
+
+	private:
+		struct Resource
+		{
+			std::string Name;
+			RenderGraphTextureDesc Desc;
+			Ref<Framebuffer> Imported;
+
+			// Declaration state, the pass that wrote it last and who read that write
+			uint32_t Writer = Invalid;
+			FrameVector<uint32_t> Readers;
+
+			// Positions in the execution order, set by Compile
+			uint32_t FirstUse = Invalid;
+			uint32_t LastUse = Invalid;
+			uint32_t Physical = Invalid;
+		};
+
+		struct Pass
+		{
+			std::string Name;
+			ExecuteFn Execute;
+
+			FrameVector<RenderGraphResource> Reads;
+			RenderGraphResource Output = Invalid;
+			// Passes whose output this one reads, they run first and are kept as long as this one is
+			FrameVector<uint32_t> Dependencies;
+			// Readers of what this pass overwrites, they run first if they aren't culled
+			FrameVector<uint32_t> After;
+			bool SideEffect = false;
+		};
+
+		struct PhysicalTarget
+		{
+			RenderGraphTextureDesc Desc;
+			Ref<Framebuffer> Target;
+			bool Free = false;
+		};
+
+		void AddDependency(uint32_t pass, uint32_t dependency);
+		void MarkLive(uint32_t pass, FrameVector<uint8_t>& live);
+		void Visit(uint32_t pass, const FrameVector<uint8_t>& live, FrameVector<uint8_t>& state);
+
+	private:
+		std::vector<Pass> m_Passes;
+		std::vector<Resource> m_Resources;
+
+		std::vector<uint32_t> m_Order;
+		std::vector<PhysicalTarget> m_Physical;
+		bool m_Compiled = false;
+
+		RenderGraphStats m_Stats;
+		RenderTargetPool m_Targets;
+
+		friend class RenderGraphBuilder;
+	};
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RoMan
+{
+	// 32-bit reference into a backend resource pool: the low bits index a slot, the high bits hold
+	// the slot's generation so a handle to a destroyed resource can be told apart from its successor
+	template<typename Tag>
+	struct RenderHandle
+	{
+		static constexpr uint32_t IndexBits = 20;
+		static constexpr uint32_t GenerationBits = 32 - IndexBits;
+		static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+		static constexpr uint32_t GenerationMask = (1u << GenerationBits) - 1;
+		static constexpr uint32_t InvalidValue = 0xFFFFFFFF;
+
+		uint32_t Value = InvalidValue;
+
+		static RenderHandle Make(uint32_t index, uint32_t generation)
+		{
+			RenderHandle handle;
+			handle.Value = (index & IndexMask) | ((generation & GenerationMask) << IndexBits);
+			return handle;
+		}
+
+		uint32_t GetIndex() const { return Value & IndexMask; }
+		uint32_t GetGeneration() const { return Value >> IndexBits; }
+		bool IsValid() const { return Value != InvalidValue; }
+
+		bool operator==(const RenderHandle& other) const { return Value == other.Value; }
+		bool operator!=(const RenderHandle& other) const { return Value != other.Value; }
+	};
+
+	using TextureHandle = RenderHandle<struct TextureHandleTag>;
+	using BufferHandle = RenderHandle<struct BufferHandleTag>;
+	using ShaderHandle = RenderHandle<struct ShaderHandleTag>;
+	using VertexArrayHandle = RenderHandle<struct VertexArrayHandleTag>;
+
+	struct DrawIndexedCommand
+	{
+		VertexArrayHandle VertexArray;
+		uint32_t IndexCount = 0;
+	};
+}
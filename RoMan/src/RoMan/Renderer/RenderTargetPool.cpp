@@ -0,0 +1,71 @@
+#include "rmpch.h"
+#include "RenderTargetPool.h"
+
+namespace RoMan
+{
+	Ref<Framebuffer> RenderTargetPool::Acquire(uint32_t width, uint32_t height, FramebufferTextureFormat format)
+	{
+		for (Entry& entry : m_Targets)
+		{
+			const FramebufferSpecification& specification = entry.Target->GetSpecification();
+			if (entry.InUse || entry.Format != format || specification.Width != width || specification.Height != height)
+				continue;
+
+			entry.InUse = true;
+			entry.LastUsedFrame = m_Frame;
+			return entry.Target;
+		}
+
+		FramebufferSpecification specification;
+		specification.Width = width;
+		specification.Height = height;
+		specification.Attachments = { format };
+
+		Entry& entry = m_Targets.emplace_back();
+		entry.Target = Framebuffer::Create(specification);
+		entry.Format = format;
+		entry.InUse = true;
+		entry.LastUsedFrame = m_Frame;
+		return entry.Target;
+	}
+
+	void RenderTargetPool::Release(const Ref<Framebuffer>& target)
+	{
+		for (Entry& entry : m_Targets)
+		{
+			if (entry.Target != target)
+				continue;
+
+			RM_CORE_ASSERT(entry.InUse, "Render target released twice!");
+			entry.InUse = false;
+			return;
+		}
+
+		RM_CORE_ASSERT(false, "Render target is not from this pool!");
+	}
+
+	void RenderTargetPool::EndFrame()
+	{
+		m_Targets.erase(std::remove_if(m_Targets.begin(), m_Targets.end(), [this](const Entry& entry)
+			{
+				return !entry.InUse && m_Frame - entry.LastUsedFrame > MaxIdleFrames;
+			}), m_Targets.end());
+
+		m_Frame++;
+	}
+
+	void RenderTargetPool::Clear()
+	{
+		for (const Entry& entry : m_Targets)
+			RM_CORE_ASSERT(!entry.InUse, "Render target pool cleared while a target is acquired!");
+		m_Targets.clear();
+	}
+
+	uint64_t RenderTargetPool::GetMemorySize() const
+	{
+		uint64_t size = 0;
+		for (const Entry& entry : m_Targets)
+			size += entry.Target->GetMemorySize();
+		return size;
+	}
+}
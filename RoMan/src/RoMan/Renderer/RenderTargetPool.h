@@ -0,0 +1,37 @@
+#pragma once
+
+#include "RoMan/Renderer/Framebuffer.h"
+
+namespace RoMan
+{
+	// Single attachment framebuffers for intermediate results. A released target goes back to the pool
+	// and the next Acquire of the same size and format gets it instead of a new allocation.
+	class RenderTargetPool
+	{
+	public:
+		// Frames a free target is kept without being acquired, covers the frames around a resize
+		static constexpr uint32_t MaxIdleFrames = 3;
+
+		Ref<Framebuffer> Acquire(uint32_t width, uint32_t height, FramebufferTextureFormat format);
+		void Release(const Ref<Framebuffer>& target);
+
+		// Frees targets that were idle for longer than MaxIdleFrames
+		void EndFrame();
+		void Clear();
+
+		uint32_t GetTargetCount() const { return (uint32_t)m_Targets.size(); }
+		uint64_t GetMemorySize() const;
+
+	private:
+		struct Entry
+		{
+			Ref<Framebuffer> Target;
+			FramebufferTextureFormat Format;
+			bool InUse = false;
+			uint32_t LastUsedFrame = 0;
+		};
+
+		std::vector<Entry> m_Targets;
+		uint32_t m_Frame = 0;
+	};
+}
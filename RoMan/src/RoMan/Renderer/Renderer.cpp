@@ -1,7 +1,8 @@
 #include "rmpch.h"
 #include "Renderer.h"
 
-#include "Platform/OpenGL/OpenGLShader.h"
+#include "RoMan/Core/FrameStats.h"
+
 
 namespace RoMan
 {
@@ -12,20 +13,44 @@ namespace RoMan
 		RenderCommand::Init();
 	}
 
-	void Renderer::BeginScene(OrthographicCamera& camera)
+	void Renderer::OnWindowResize(uint32_t width, uint32_t height)
+	{
+		s_SceneData->ScreenWidth = width;
+		s_SceneData->ScreenHeight = height;
+		RenderCommand::SetViewport(0, 0, width, height);
+	}
+
+	void Renderer::BeginScene(const Camera& camera)
 	{
 		s_SceneData->ViewProjectionMatrix = camera.GetViewProjectionMatrix();
+		s_SceneData->ViewFrustum = Frustum(s_SceneData->ViewProjectionMatrix);
 	}
 	void Renderer::EndScene()
 	{
 	}
-	void Renderer::Submit(const std::shared_ptr<Shader>& shader, const std::shared_ptr<VertexArray>& vertexArray, const glm::mat4& transform)
+	void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform)
 	{
+		const AABB& bounds = vertexArray->GetBounds();
+		if (s_SceneData->CullingEnabled && bounds.IsValid() && !s_SceneData->ViewFrustum.IsVisible(bounds.Transform(transform)))
+		{
+			FrameStats::RecordCulledDraw();
+			return;
+		}
+
 		shader->Bind();
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMatrix4("u_ViewProjection", s_SceneData->ViewProjectionMatrix);
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMatrix4("u_Transform", transform);
+		shader->SetMat4("u_ViewProjection", s_SceneData->ViewProjectionMatrix);
+		shader->SetMat4("u_Transform", transform);
 
-		vertexArray->Bind();
 		RenderCommand::DrawIndexed(vertexArray);
 	}
+
+	void Renderer::SetCullingEnabled(bool enabled)
+	{
+		s_SceneData->CullingEnabled = enabled;
+	}
+
+	bool Renderer::IsCullingEnabled()
+	{
+		return s_SceneData->CullingEnabled;
+	}
 }
\ No newline at end of file
@@ -1,8 +1,9 @@
 #pragma once
 #include "RenderCommand.h"
 
-#include "OrthographicCamera.h"
+#include "Camera.h"
 #include "Shader.h"
+#include "RoMan/Math/Frustum.h"
 
 namespace RoMan
 {
@@ -10,16 +11,29 @@ namespace RoMan
 	{
 	public:
 		static void Init();
+		// Resets the viewport to the new window size, framebuffers restore it when unbound
+		static void OnWindowResize(uint32_t width, uint32_t height);
+		static uint32_t GetScreenWidth() { return s_SceneData->ScreenWidth; }
+		static uint32_t GetScreenHeight() { return s_SceneData->ScreenHeight; }
 
-		static void BeginScene(OrthographicCamera& camera);
+		static void BeginScene(const Camera& camera);
 		static void EndScene();
 
-		static void Submit(const std::shared_ptr<Shader>& shader, const std::shared_ptr<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f));
+		static void Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f));
+
+		// On by default, submissions whose bounds are outside the camera's view are dropped
+		static void SetCullingEnabled(bool enabled);
+		static bool IsCullingEnabled();
+
 		inline static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
 	private:
 		struct SceneData
 		{
 			glm::mat4 ViewProjectionMatrix;
+			Frustum ViewFrustum;
+			bool CullingEnabled = true;
+			uint32_t ScreenWidth = 0;
+			uint32_t ScreenHeight = 0;
 		};
 
 		static SceneData* s_SceneData;
@@ -1,7 +1,29 @@
 #include "rmpch.h"
 #include "RendererAPI.h"
 
+#include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Null/NullRendererAPI.h"
+
 namespace RoMan
 {
 	RendererAPI::API RendererAPI::s_API = RendererAPI::API::OpenGL;
-}
\ No newline at end of file
+
+	RendererAPI* RendererAPI::Create()
+	{
+		switch (s_API)
+		{
+		case RendererAPI::API::None:
+			RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+			return nullptr;
+
+		case RendererAPI::API::OpenGL:
+			return new OpenGLRendererAPI();
+
+		case RendererAPI::API::Null:
+			return new NullRendererAPI();
+		}
+
+		RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+		return nullptr;
+	}
+}
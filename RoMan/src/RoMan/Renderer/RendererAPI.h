@@ -10,17 +10,26 @@ namespace RoMan
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1
+			None = 0, OpenGL = 1, Null = 2
 		};
 	public:
+		virtual ~RendererAPI() = default;
+
 		virtual void Init() = 0;
 
+		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+
 		virtual void SetClearColor(const glm::vec4& color) = 0;
 		virtual void Clear() = 0;
 
-		virtual void DrawIndexed(const std::shared_ptr<VertexArray>& vertexArray) = 0;
+		// The command binds the vertex array itself
+		virtual void DrawIndexed(const DrawIndexedCommand& command) = 0;
 
 		inline static API GetAPI() { return s_API; }
+		// Must be called before the Application is created
+		inline static void SetAPI(API api) { s_API = api; }
+
+		static RendererAPI* Create();
 	private:
 		static API s_API;
 	};
@@ -2,12 +2,18 @@
 #include "Shader.h"
 
 #include "Renderer.h"
+#include "RoMan/Asset/AssetManager.h"
+#include "RoMan/Asset/VirtualFileSystem.h"
+#include "RoMan/Core/MemoryTracker.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Null/NullShader.h"
 
 namespace RoMan
 {
 	Ref<Shader> Shader::Create(const std::string& filepath)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Shader);
+
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
@@ -15,7 +21,10 @@ namespace RoMan
 			return nullptr;
 
 		case RendererAPI::API::OpenGL:
-			return  std::make_shared<OpenGLShader>(filepath);
+			return  CreateRef<OpenGLShader>(filepath);
+
+		case RendererAPI::API::Null:
+			return CreateRef<NullShader>(filepath);
 
 		}
 
@@ -26,6 +35,8 @@ namespace RoMan
 
 	Ref<Shader> Shader::Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Shader);
+
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
@@ -33,7 +44,10 @@ namespace RoMan
 			return nullptr;
 
 		case RendererAPI::API::OpenGL:
-			return std::make_shared<OpenGLShader>(name, vertexSrc, fragmentSrc);
+			return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+
+		case RendererAPI::API::Null:
+			return CreateRef<NullShader>(name, vertexSrc, fragmentSrc);
 
 		}
 
@@ -41,9 +55,41 @@ namespace RoMan
 		return nullptr;
 	}
 
+	bool Shader::LoadStageSources(const std::string& filepath, ShaderStageSources& out)
+	{
+		FileData file = VirtualFileSystem::ReadFile(filepath);
+		if (!file)
+		{
+			RM_CORE_ERROR("Couldn't open file path {0}", filepath);
+			return false;
+		}
+
+		if (!ReadShaderSources(file.Data, file.Size, out))
+		{
+			RM_CORE_ERROR("Couldn't parse shader {0}", filepath);
+			return false;
+		}
+
+		return true;
+	}
+
+	std::string Shader::GetNameFromPath(const std::string& filepath)
+	{
+		auto lastSlash = filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+		return filepath.substr(lastSlash, count);
+	}
+
 	void ShaderLibrary::Add(const std::string& name, const Ref<Shader>& shader)
 	{
-		RM_CORE_ASSERT(!Exists(name), "Shader already exists!");
+		auto it = m_Shaders.find(name);
+		if (it != m_Shaders.end())
+		{
+			RM_CORE_ASSERT(it->second == shader, "A different shader with this name already exists!");
+			return;
+		}
 		m_Shaders[name] = shader;
 	}
 
@@ -55,13 +101,13 @@ namespace RoMan
 
 	Ref<Shader> ShaderLibrary::Load(const std::string& filepath)
 	{
-		auto shader = Shader::Create(filepath);
+		auto shader = AssetManager::Load<Shader>(filepath);
 		Add(shader);
 		return shader;
 	}
 	Ref<Shader> ShaderLibrary::Load(const std::string& name, const std::string& filepath)
 	{
-		auto shader = Shader::Create(filepath);
+		auto shader = AssetManager::Load<Shader>(filepath);
 		Add(name, shader);
 		return shader;
 	}
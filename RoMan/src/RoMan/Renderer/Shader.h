@@ -3,9 +3,14 @@
 #include <string>
 #include <unordered_map>
 
+#include "glm/glm.hpp"
+
+#include "RoMan/Asset/CookedFormats.h"
+#include "RoMan/Renderer/RenderHandle.h"
+
 namespace RoMan
 {
-	class Shader
+	class Shader : public RefCounted
 	{
 	public:
 		virtual ~Shader() = default;
@@ -13,17 +18,33 @@ namespace RoMan
 		virtual void Bind() const = 0;
 		virtual void UnBind() const = 0;
 		
+		virtual void SetInt(const char* name, int value) = 0;
+		virtual void SetFloat(const char* name, float value) = 0;
+		virtual void SetFloat2(const char* name, const glm::vec2& value) = 0;
+		virtual void SetFloat3(const char* name, const glm::vec3& value) = 0;
+		virtual void SetFloat4(const char* name, const glm::vec4& value) = 0;
+		virtual void SetMat4(const char* name, const glm::mat4& value) = 0;
+
 		virtual const std::string& GetName() const = 0;
+		virtual ShaderHandle GetHandle() const = 0;
 
 		static Ref<Shader> Create(const std::string& filepath);
 		static Ref<Shader> Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+
+	protected:
+		// Reads a shader file through the VirtualFileSystem and splits it into stages, false with an error logged
+		static bool LoadStageSources(const std::string& filepath, ShaderStageSources& out);
+		// "assets/shaders/Texture.glsl" is named "Texture"
+		static std::string GetNameFromPath(const std::string& filepath);
 	};
 
 	class ShaderLibrary
 	{
 	public:
+		// Adding the same shader under its name again is a no-op
 		void Add(const std::string& name, const Ref<Shader>& shader);
 		void Add(const Ref<Shader>& shader);
+		// Loads through the AssetManager, a file that is already loaded returns the existing shader
 		Ref<Shader> Load(const std::string& filepath);
 		Ref<Shader> Load(const std::string& name, const std::string& filepath);
 
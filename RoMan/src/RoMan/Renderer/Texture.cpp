@@ -2,12 +2,16 @@
 #include "Texture.h"
 
 #include "Renderer.h"
+#include "RoMan/Core/MemoryTracker.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Null/NullTexture.h"
 
 namespace RoMan
 {
 	Ref<Texture2D> Texture2D::Create(const std::string& path)
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Texture);
+
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
@@ -15,7 +19,10 @@ namespace RoMan
 			return nullptr;
 
 		case RendererAPI::API::OpenGL:
-			return  std::make_shared<OpenGLTexture2D>(path);
+			return  CreateRef<OpenGLTexture2D>(path);
+
+		case RendererAPI::API::Null:
+			return CreateRef<NullTexture2D>(path);
 
 		}
 
@@ -3,23 +3,29 @@
 #include<string>
 
 #include "RoMan/Core.h"
+#include "RoMan/Renderer/RenderHandle.h"
 
 namespace RoMan
 {
-	class Texture
+	class Texture : public RefCounted
 	{
 	public:
 		virtual ~Texture() = default;
 
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
+		// Bytes of texel data, used for asset memory budgets
+		virtual uint64_t GetMemorySize() const = 0;
 
 		virtual void Bind(uint32_t slot = 0) const = 0;
+
+		virtual TextureHandle GetHandle() const = 0;
 	};
 
 	class Texture2D : public Texture
 	{
 	public:
+		// Always decodes and uploads, use AssetManager::Load<Texture2D> to share loaded textures
 		static Ref<Texture2D> Create(const std::string& path);
 	};
 }
\ No newline at end of file
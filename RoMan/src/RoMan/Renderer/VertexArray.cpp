@@ -2,12 +2,16 @@
 #include "VertexArray.h"
 
 #include "Renderer.h"
+#include "RoMan/Core/MemoryTracker.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Null/NullVertexArray.h"
 
 namespace RoMan
 {
 	VertexArray* VertexArray::Create()
 	{
+		RM_MEMORY_SCOPE(MemoryTag::Renderer);
+
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None: 
@@ -16,7 +20,10 @@ namespace RoMan
 
 		case RendererAPI::API::OpenGL: 
 			return new OpenGLVertexArray();
-				
+
+		case RendererAPI::API::Null:
+			return new NullVertexArray();
+
 		}
 
 		RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
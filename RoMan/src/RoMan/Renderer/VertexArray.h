@@ -1,10 +1,11 @@
 #pragma once
-#include <memory>
 #include <RoMan/Renderer/Buffer.h>
+#include "RoMan/Renderer/RenderHandle.h"
+#include "RoMan/Math/AABB.h"
 
 namespace RoMan
 {
-	class VertexArray
+	class VertexArray : public RefCounted
 	{
 	public:
 		virtual ~VertexArray() {}
@@ -12,12 +13,21 @@ namespace RoMan
 		virtual void Bind() const = 0;
 		virtual void UnBind() const = 0;
 
-		virtual void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) = 0;
-		virtual void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) = 0;
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) = 0;
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) = 0;
 
-		virtual const std::vector<std::shared_ptr<VertexBuffer>>& GetVertexBuffers() const = 0;
-		virtual const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const = 0;
+		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const = 0;
+		virtual const Ref<IndexBuffer>& GetIndexBuffer() const = 0;
+
+		virtual VertexArrayHandle GetHandle() const = 0;
+
+		// Local space bounds of the vertices, used by Renderer::Submit to cull off-screen draws.
+		// Vertex data isn't kept on the CPU, so the creator sets them. Without bounds nothing is culled.
+		void SetBounds(const AABB& bounds) { m_Bounds = bounds; }
+		const AABB& GetBounds() const { return m_Bounds; }
 
 		static VertexArray* Create();
+	private:
+		AABB m_Bounds;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,353 @@
+#include "rmpch.h"
+#include "VirtualTexture.h"
+
+#include "Renderer.h"
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Core/MemoryTracker.h"
+#include "Platform/OpenGL/OpenGLVirtualTexture.h"
+#include "Platform/Null/NullVirtualTexture.h"
+
+namespace RoMan
+{
+	static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	Ref<VirtualTexture2D> VirtualTexture2D::Create(const std::string& path, const VirtualTextureSpecification& specification)
+	{
+		RM_MEMORY_SCOPE(MemoryTag::Texture);
+
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:
+			RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+			return nullptr;
+
+		case RendererAPI::API::OpenGL:
+			return CreateRef<OpenGLVirtualTexture2D>(path, specification);
+
+		case RendererAPI::API::Null:
+			return CreateRef<NullVirtualTexture2D>(path, specification);
+
+		}
+
+		RM_CORE_ASSERT(false, "Renderer API is not supported by RoMan Engine");
+		return nullptr;
+	}
+
+	VirtualTexture2D::VirtualTexture2D(const std::string& path, const VirtualTextureSpecification& specification)
+		:m_Path(path), m_Specification(specification)
+	{
+		RM_CORE_ASSERT(specification.CacheSlotsPerSide > 0 && specification.CacheSlotsPerSide <= 255, "Virtual texture cache must be 1 to 255 slots per side!");
+
+		m_File = VirtualFileSystem::MapFile(path);
+		RM_CORE_ASSERT(m_File, "Couldn't open virtual texture file!");
+		bool valid = ReadCookedVirtualTexture(m_File.Data, m_File.Size, m_Texture);
+		RM_CORE_ASSERT(valid, "Invalid virtual texture, cook it with RoManCook!");
+
+		uint32_t pageCount = m_Texture.Header->PageCount;
+		m_CoarsestPage = pageCount - 1;
+		m_PageStates.assign(pageCount, PageState::Unloaded);
+		m_PageSlots.assign(pageCount, InvalidIndex);
+		m_PageLastUsed.assign(pageCount, 0);
+		m_PageRequested.assign(pageCount, 0);
+		m_PageTable.assign(pageCount, 0);
+
+		uint32_t slotCount = m_Specification.CacheSlotsPerSide * m_Specification.CacheSlotsPerSide;
+		m_SlotPages.assign(slotCount, InvalidIndex);
+		m_SlotIterators.resize(slotCount, m_LRU.end());
+		m_FreeSlots.reserve(slotCount);
+		for (uint32_t slot = slotCount; slot > 0; slot--)
+			m_FreeSlots.push_back(slot - 1);
+
+		m_Loader = std::thread(&VirtualTexture2D::LoaderLoop, this);
+	}
+
+	VirtualTexture2D::~VirtualTexture2D()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Stop = true;
+		}
+		m_Condition.notify_all();
+		m_Loader.join();
+	}
+
+	uint64_t VirtualTexture2D::GetMemorySize() const
+	{
+		uint64_t atlasSize = GetAtlasSize();
+		return atlasSize * atlasSize * 4 + (uint64_t)m_Texture.Header->PageCount * 4;
+	}
+
+	void VirtualTexture2D::RequestRegion(const glm::vec2& uvMin, const glm::vec2& uvMax, float screenWidth)
+	{
+		glm::vec4 parameters = GetShaderParameters();
+		glm::vec2 scale = { parameters.x, parameters.y };
+		glm::vec2 min = glm::clamp(glm::min(uvMin, uvMax) * scale, glm::vec2(0.0f), glm::vec2(1.0f));
+		glm::vec2 max = glm::clamp(glm::max(uvMin, uvMax) * scale, glm::vec2(0.0f), glm::vec2(1.0f));
+
+		// Matches the level the shader picks from the screen space derivatives
+		float texelsPerPixel = m_Texture.Header->Width / std::max(screenWidth, 1.0f);
+		uint32_t firstLevel = texelsPerPixel > 1.0f ? (uint32_t)std::floor(std::log2(texelsPerPixel)) : 0;
+		firstLevel = std::min(firstLevel, GetLevelCount() - 1);
+
+		// Coarser levels too, they are the fallback while the wanted pages stream in
+		for (uint32_t level = firstLevel; level < GetLevelCount(); level++)
+		{
+			const CookedVirtualTextureMip& mip = m_Texture.Mips[level];
+			uint32_t x0 = std::min((uint32_t)(min.x * mip.PagesPerSide), mip.PagesPerSide - 1);
+			uint32_t y0 = std::min((uint32_t)(min.y * mip.PagesPerSide), mip.PagesPerSide - 1);
+			uint32_t x1 = std::min((uint32_t)(max.x * mip.PagesPerSide), mip.PagesPerSide - 1);
+			uint32_t y1 = std::min((uint32_t)(max.y * mip.PagesPerSide), mip.PagesPerSide - 1);
+
+			for (uint32_t y = y0; y <= y1; y++)
+			{
+				for (uint32_t x = x0; x <= x1; x++)
+				{
+					uint32_t page = mip.FirstPage + y * mip.PagesPerSide + x;
+					if (m_PageRequested[page] == m_Frame)
+						continue;
+
+					m_PageRequested[page] = m_Frame;
+					m_Requests.push_back(page);
+				}
+			}
+		}
+	}
+
+	void VirtualTexture2D::RequestQuad(const Camera& camera, const glm::mat4& transform, const glm::vec2& viewportSize)
+	{
+		AABB quad = AABB({ -0.5f, -0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f }).Transform(transform);
+		AABB view = camera.GetBounds();
+
+		glm::vec2 quadMin = { quad.Min.x, quad.Min.y };
+		glm::vec2 quadSize = glm::vec2(quad.Max.x, quad.Max.y) - quadMin;
+		glm::vec2 visibleMin = glm::max(quadMin, glm::vec2(view.Min.x, view.Min.y));
+		glm::vec2 visibleMax = glm::min(glm::vec2(quad.Max.x, quad.Max.y), glm::vec2(view.Max.x, view.Max.y));
+		if (visibleMin.x > visibleMax.x || visibleMin.y > visibleMax.y || quadSize.x <= 0.0f || quadSize.y <= 0.0f)
+			return;
+
+		float screenWidth = quadSize.x / (view.Max.x - view.Min.x) * viewportSize.x;
+		RequestRegion((visibleMin - quadMin) / quadSize, (visibleMax - quadMin) / quadSize, screenWidth);
+	}
+
+	void VirtualTexture2D::Update()
+	{
+		if (!m_Initialized)
+		{
+			// Pinned for good, it is what everything falls back to
+			LoadedPage coarsest = { m_CoarsestPage, std::vector<uint8_t>(m_Texture.GetPageSize()) };
+			bool loaded = ReadCookedVirtualTexturePage(m_Texture, m_CoarsestPage, coarsest.Pixels.data());
+			RM_CORE_ASSERT(loaded, "Corrupt virtual texture page!");
+
+			uint32_t slot = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+			UploadPage(slot % m_Specification.CacheSlotsPerSide, slot / m_Specification.CacheSlotsPerSide, coarsest.Pixels.data());
+			m_SlotPages[slot] = m_CoarsestPage;
+			m_PageSlots[m_CoarsestPage] = slot;
+			m_PageStates[m_CoarsestPage] = PageState::Resident;
+			m_Initialized = true;
+		}
+
+		m_Stats = {};
+		m_Stats.RequestedPages = (uint32_t)m_Requests.size();
+
+		std::vector<LoadedPage> loaded;
+		uint32_t queuedPages;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			loaded.swap(m_Loaded);
+
+			// Requeue from scratch, pages nobody asked for this frame are dropped before they load
+			for (uint32_t page : m_LoadQueue)
+				m_PageStates[page] = PageState::Unloaded;
+			m_LoadQueue.clear();
+
+			for (uint32_t page : m_Requests)
+			{
+				if (m_PageStates[page] == PageState::Resident)
+				{
+					TouchPage(page);
+				}
+				else if (m_PageStates[page] == PageState::Unloaded)
+				{
+					m_PageStates[page] = PageState::Queued;
+					m_LoadQueue.push_back(page);
+				}
+			}
+
+			// Pages are stored finest level first, so the coarsest pages end up at the back and load first
+			std::sort(m_LoadQueue.begin(), m_LoadQueue.end());
+			queuedPages = (uint32_t)m_LoadQueue.size();
+		}
+		if (queuedPages > 0)
+			m_Condition.notify_one();
+
+		for (LoadedPage& page : loaded)
+			m_WaitingUploads.push_back(std::move(page));
+
+		FrameVector<std::vector<uint8_t>> freeBuffers;
+		size_t kept = 0;
+		for (size_t i = 0; i < m_WaitingUploads.size(); i++)
+		{
+			LoadedPage& page = m_WaitingUploads[i];
+
+			bool requested = m_PageRequested[page.Page] == m_Frame;
+			if (requested && (m_Stats.Uploads >= m_Specification.MaxUploadsPerFrame || !UploadLoadedPage(page)))
+			{
+				if (kept != i)
+					m_WaitingUploads[kept] = std::move(page);
+				kept++;
+				continue;
+			}
+
+			if (!requested)
+				m_PageStates[page.Page] = PageState::Unloaded;
+			freeBuffers.push_back(std::move(page.Pixels));
+		}
+		m_WaitingUploads.resize(kept);
+
+		if (!freeBuffers.empty())
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			for (std::vector<uint8_t>& buffer : freeBuffers)
+				m_FreeBuffers.push_back(std::move(buffer));
+		}
+
+		if (m_PageTableDirty)
+			RebuildPageTable();
+
+		uint32_t slotCount = m_Specification.CacheSlotsPerSide * m_Specification.CacheSlotsPerSide;
+		m_Stats.ResidentPages = slotCount - (uint32_t)m_FreeSlots.size();
+		m_Stats.PendingPages = queuedPages + (uint32_t)m_WaitingUploads.size();
+
+		m_Requests.clear();
+		m_Frame++;
+	}
+
+	glm::vec4 VirtualTexture2D::GetShaderParameters() const
+	{
+		float virtualSize = (float)(GetPagesPerSide() * m_Texture.Header->PageSize);
+		return { m_Texture.Header->Width / virtualSize, m_Texture.Header->Height / virtualSize,
+			(float)m_Texture.Header->PageSize, (float)m_Texture.Header->Border };
+	}
+
+	void VirtualTexture2D::LoaderLoop()
+	{
+		RM_MEMORY_SCOPE(MemoryTag::Texture);
+
+		while (true)
+		{
+			LoadedPage page;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Condition.wait(lock, [&]() { return m_Stop || !m_LoadQueue.empty(); });
+				if (m_Stop)
+					return;
+
+				page.Page = m_LoadQueue.back();
+				m_LoadQueue.pop_back();
+				m_PageStates[page.Page] = PageState::Loading;
+
+				if (!m_FreeBuffers.empty())
+				{
+					page.Pixels = std::move(m_FreeBuffers.back());
+					m_FreeBuffers.pop_back();
+				}
+			}
+
+			page.Pixels.resize(m_Texture.GetPageSize());
+			bool loaded = ReadCookedVirtualTexturePage(m_Texture, page.Page, page.Pixels.data());
+
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!loaded)
+			{
+				// Left Loading for good, requesting it again would only fail again
+				RM_CORE_ERROR("Corrupt page {0} in virtual texture {1}", page.Page, m_Path);
+				m_FreeBuffers.push_back(std::move(page.Pixels));
+				continue;
+			}
+
+			m_PageStates[page.Page] = PageState::Loaded;
+			m_Loaded.push_back(std::move(page));
+		}
+	}
+
+	bool VirtualTexture2D::UploadLoadedPage(LoadedPage& loaded)
+	{
+		uint32_t slot;
+		if (!m_FreeSlots.empty())
+		{
+			slot = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+		}
+		else
+		{
+			// Everything in the cache was used this frame, the page table keeps falling back until it isn't
+			if (m_LRU.empty() || m_PageLastUsed[m_SlotPages[m_LRU.back()]] >= m_Frame)
+				return false;
+
+			slot = m_LRU.back();
+			m_LRU.pop_back();
+
+			uint32_t evicted = m_SlotPages[slot];
+			m_PageStates[evicted] = PageState::Unloaded;
+			m_PageSlots[evicted] = InvalidIndex;
+			m_Stats.Evictions++;
+		}
+
+		UploadPage(slot % m_Specification.CacheSlotsPerSide, slot / m_Specification.CacheSlotsPerSide, loaded.Pixels.data());
+
+		m_SlotPages[slot] = loaded.Page;
+		m_PageSlots[loaded.Page] = slot;
+		m_PageStates[loaded.Page] = PageState::Resident;
+		m_PageLastUsed[loaded.Page] = m_Frame;
+		m_LRU.push_front(slot);
+		m_SlotIterators[slot] = m_LRU.begin();
+
+		m_PageTableDirty = true;
+		m_Stats.Uploads++;
+		return true;
+	}
+
+	void VirtualTexture2D::TouchPage(uint32_t page)
+	{
+		m_PageLastUsed[page] = m_Frame;
+		if (page == m_CoarsestPage)
+			return;
+
+		uint32_t slot = m_PageSlots[page];
+		m_LRU.splice(m_LRU.begin(), m_LRU, m_SlotIterators[slot]);
+	}
+
+	void VirtualTexture2D::RebuildPageTable()
+	{
+		// Coarse to fine, a page that isn't resident inherits the entry of the page covering it.
+		// Slots rather than states, the loader thread writes those.
+		for (uint32_t level = GetLevelCount(); level > 0; level--)
+		{
+			const CookedVirtualTextureMip& mip = m_Texture.Mips[level - 1];
+			for (uint32_t y = 0; y < mip.PagesPerSide; y++)
+			{
+				for (uint32_t x = 0; x < mip.PagesPerSide; x++)
+				{
+					uint32_t page = mip.FirstPage + y * mip.PagesPerSide + x;
+					uint32_t slot = m_PageSlots[page];
+					if (slot != InvalidIndex)
+					{
+						uint32_t slotX = slot % m_Specification.CacheSlotsPerSide;
+						uint32_t slotY = slot / m_Specification.CacheSlotsPerSide;
+						m_PageTable[page] = slotX | (slotY << 8) | ((level - 1) << 16) | 0xFF000000;
+					}
+					else
+					{
+						const CookedVirtualTextureMip& parent = m_Texture.Mips[level];
+						m_PageTable[page] = m_PageTable[parent.FirstPage + (y / 2) * parent.PagesPerSide + x / 2];
+					}
+				}
+			}
+
+			UploadPageTable(level - 1, m_PageTable.data() + mip.FirstPage);
+		}
+
+		m_PageTableDirty = false;
+	}
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "RoMan/Renderer/Texture.h"
+#include "RoMan/Renderer/Camera.h"
+#include "RoMan/Asset/CookedFormats.h"
+#include "RoMan/Asset/VirtualFileSystem.h"
+
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace RoMan
+{
+	struct VirtualTextureSpecification
+	{
+		// The cache atlas holds this many pages squared, at most 255
+		uint32_t CacheSlotsPerSide = 32;
+		// Loaded pages beyond this wait for the next Update
+		uint32_t MaxUploadsPerFrame = 16;
+	};
+
+	struct VirtualTextureStats
+	{
+		uint32_t RequestedPages = 0;
+		uint32_t ResidentPages = 0;
+		uint32_t PendingPages = 0;
+		uint32_t Uploads = 0;
+		uint32_t Evictions = 0;
+	};
+
+	// A texture too big to keep on the GPU, streamed in pages from a RoManCook virtual texture
+	// (*.virtual.png). Only the pages the renderer asks for stay resident in a fixed size cache atlas,
+	// least recently used pages make room for new ones. A page table texture maps every page of every
+	// level to its atlas slot, or to the nearest coarser page that is resident, so sampling never
+	// misses. The coarsest level is a single page that is always resident.
+	//
+	// Each frame: RequestRegion/RequestQuad for what will be drawn, then Update on the render thread.
+	// Pages load on a background thread and show up a few frames later, coarse ones first.
+	//
+	// Bind(slot) binds the atlas to slot and the page table to slot + 1. Shaders sample with
+	// SampleVirtual from VirtualTexture.glsl, given u_PageTable and GetShaderParameters().
+	class VirtualTexture2D : public Texture2D
+	{
+	public:
+		virtual ~VirtualTexture2D();
+
+		virtual uint32_t GetWidth() const override { return m_Texture.Header->Width; }
+		virtual uint32_t GetHeight() const override { return m_Texture.Header->Height; }
+		virtual uint64_t GetMemorySize() const override;
+
+		// uvMin/uvMax is the part of the texture that will be sampled, screenWidth the number of pixels
+		// the texture's full width covers on screen, which picks the level
+		void RequestRegion(const glm::vec2& uvMin, const glm::vec2& uvMax, float screenWidth);
+		// Same for a unit quad drawn with transform, from what the camera sees
+		void RequestQuad(const Camera& camera, const glm::mat4& transform, const glm::vec2& viewportSize);
+
+		// Uploads loaded pages, queues loads for this frame's requests and refreshes the page table
+		void Update();
+
+		// x, y: scale from texture UVs to the padded virtual space, z: page size, w: border
+		glm::vec4 GetShaderParameters() const;
+
+		const VirtualTextureStats& GetStats() const { return m_Stats; }
+
+		static Ref<VirtualTexture2D> Create(const std::string& path, const VirtualTextureSpecification& specification = {});
+
+	protected:
+		VirtualTexture2D(const std::string& path, const VirtualTextureSpecification& specification);
+
+		// Pixels are GetSlotSize()^2 RGBA8 texels
+		virtual void UploadPage(uint32_t slotX, uint32_t slotY, const uint8_t* pixels) = 0;
+		// One RGBA8 entry per page of the level: atlas slot x, slot y, level of the page in that slot
+		virtual void UploadPageTable(uint32_t level, const uint32_t* entries) = 0;
+
+		uint32_t GetSlotSize() const { return m_Texture.GetSlotSize(); }
+		uint32_t GetAtlasSize() const { return m_Specification.CacheSlotsPerSide * GetSlotSize(); }
+		uint32_t GetPagesPerSide() const { return m_Texture.Mips[0].PagesPerSide; }
+		uint32_t GetLevelCount() const { return m_Texture.Header->MipCount; }
+
+	private:
+		enum class PageState : uint8_t
+		{
+			Unloaded = 0, Queued, Loading, Loaded, Resident
+		};
+
+		struct LoadedPage
+		{
+			uint32_t Page;
+			std::vector<uint8_t> Pixels;
+		};
+
+		void LoaderLoop();
+		bool UploadLoadedPage(LoadedPage& loaded);
+		void TouchPage(uint32_t page);
+		void RebuildPageTable();
+
+	private:
+		std::string m_Path;
+		VirtualTextureSpecification m_Specification;
+		// Mapped, the loader only pages in the byte ranges of the pages it reads
+		FileData m_File;
+		CookedVirtualTexture m_Texture;
+		uint32_t m_CoarsestPage = 0;
+
+		// Page state is shared with the loader, everything else is render thread only
+		std::vector<PageState> m_PageStates;
+		std::vector<uint32_t> m_PageSlots;
+		std::vector<uint64_t> m_PageLastUsed;
+		std::vector<uint64_t> m_PageRequested;
+		std::vector<uint32_t> m_Requests;
+
+		std::vector<uint32_t> m_SlotPages;
+		std::vector<std::list<uint32_t>::iterator> m_SlotIterators;
+		std::list<uint32_t> m_LRU;  // Slots, most recently used first
+		std::vector<uint32_t> m_FreeSlots;
+		std::vector<LoadedPage> m_WaitingUploads;
+
+		std::vector<uint32_t> m_PageTable;
+		bool m_PageTableDirty = true;
+		bool m_Initialized = false;
+		uint64_t m_Frame = 1;
+
+		std::thread m_Loader;
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		std::vector<uint32_t> m_LoadQueue;  // Next page at the back
+		std::vector<LoadedPage> m_Loaded;
+		std::vector<std::vector<uint8_t>> m_FreeBuffers;
+		bool m_Stop = false;
+
+		VirtualTextureStats m_Stats;
+	};
+}
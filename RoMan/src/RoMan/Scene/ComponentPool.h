@@ -0,0 +1,103 @@
+#pragma once
+
+#include "RoMan/Core.h"
+
+#include <vector>
+
+namespace RoMan
+{
+	// Low bits index the entity slot, high bits count how often the slot was reused
+	using EntityID = uint32_t;
+
+	constexpr uint32_t EntityIndexBits = 20;
+	constexpr uint32_t EntityIndexMask = (1u << EntityIndexBits) - 1;
+	constexpr EntityID NullEntity = 0xFFFFFFFF;
+
+	inline uint32_t GetEntityIndex(EntityID entity) { return entity & EntityIndexMask; }
+	inline uint32_t GetEntityGeneration(EntityID entity) { return entity >> EntityIndexBits; }
+
+	class ComponentPoolBase
+	{
+	public:
+		virtual ~ComponentPoolBase() = default;
+
+		virtual void Remove(EntityID entity) = 0;
+
+		bool Has(EntityID entity) const
+		{
+			uint32_t index = GetEntityIndex(entity);
+			return index < m_Sparse.size() && m_Sparse[index] != InvalidIndex && m_Dense[m_Sparse[index]] == entity;
+		}
+
+		uint32_t GetSize() const { return (uint32_t)m_Dense.size(); }
+		const EntityID* GetEntities() const { return m_Dense.data(); }
+		// Position of the entity's component in the dense arrays, the entity must have one
+		uint32_t GetIndex(EntityID entity) const { return m_Sparse[GetEntityIndex(entity)]; }
+
+		// Changes on every Add and Remove, cached queries compare it to know when to rebuild
+		uint32_t GetVersion() const { return m_Version; }
+
+	protected:
+		static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+		uint32_t m_Version = 0;
+
+		// Entity index -> position in the dense arrays
+		std::vector<uint32_t> m_Sparse;
+		std::vector<EntityID> m_Dense;
+	};
+
+	// Sparse set: components of one type are packed in a contiguous array, in the same order as
+	// the entities that own them, so iterating a pool is a linear walk over memory
+	template<typename T>
+	class ComponentPool : public ComponentPoolBase
+	{
+	public:
+		template<typename... Args>
+		T& Add(EntityID entity, Args&&... args)
+		{
+			RM_CORE_ASSERT(!Has(entity), "Entity already has component!");
+
+			uint32_t index = GetEntityIndex(entity);
+			if (index >= m_Sparse.size())
+				m_Sparse.resize(index + 1, InvalidIndex);
+
+			m_Sparse[index] = (uint32_t)m_Dense.size();
+			m_Dense.push_back(entity);
+			m_Components.emplace_back(std::forward<Args>(args)...);
+			m_Version++;
+			return m_Components.back();
+		}
+
+		virtual void Remove(EntityID entity) override
+		{
+			RM_CORE_ASSERT(Has(entity), "Entity does not have component!");
+
+			// Swap with the last element to keep the arrays packed
+			uint32_t position = m_Sparse[GetEntityIndex(entity)];
+			uint32_t last = (uint32_t)m_Dense.size() - 1;
+			if (position != last)
+			{
+				m_Dense[position] = m_Dense[last];
+				m_Components[position] = std::move(m_Components[last]);
+				m_Sparse[GetEntityIndex(m_Dense[position])] = position;
+			}
+
+			m_Dense.pop_back();
+			m_Components.pop_back();
+			m_Sparse[GetEntityIndex(entity)] = InvalidIndex;
+			m_Version++;
+		}
+
+		T& Get(EntityID entity)
+		{
+			RM_CORE_ASSERT(Has(entity), "Entity does not have component!");
+			return m_Components[m_Sparse[GetEntityIndex(entity)]];
+		}
+
+		T* GetComponents() { return m_Components.data(); }
+
+	private:
+		std::vector<T> m_Components;
+	};
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace RoMan
+{
+	struct TagComponent
+	{
+		std::string Tag;
+
+		TagComponent() = default;
+		TagComponent(const std::string& tag)
+			: Tag(tag) {}
+	};
+
+	struct TransformComponent
+	{
+		glm::vec3 Translation = { 0.0f, 0.0f, 0.0f };
+		float Rotation = 0.0f; // Radians, around Z
+		glm::vec3 Scale = { 1.0f, 1.0f, 1.0f };
+
+		TransformComponent() = default;
+		TransformComponent(const glm::vec3& translation)
+			: Translation(translation) {}
+
+		glm::mat4 GetTransform() const
+		{
+			return glm::translate(glm::mat4(1.0f), Translation)
+				* glm::rotate(glm::mat4(1.0f), Rotation, { 0.0f, 0.0f, 1.0f })
+				* glm::scale(glm::mat4(1.0f), Scale);
+		}
+	};
+
+	struct SpriteRendererComponent
+	{
+		glm::vec4 Color = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+		SpriteRendererComponent() = default;
+		SpriteRendererComponent(const glm::vec4& color)
+			: Color(color) {}
+	};
+}
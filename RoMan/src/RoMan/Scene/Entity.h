@@ -0,0 +1,50 @@
+#pragma once
+
+#include "RoMan/Scene/Scene.h"
+
+namespace RoMan
+{
+	// Lightweight handle, copy it around freely
+	class Entity
+	{
+	public:
+		Entity() = default;
+		Entity(EntityID id, Scene* scene)
+			: m_ID(id), m_Scene(scene) {}
+
+		template<typename T, typename... Args>
+		T& AddComponent(Args&&... args)
+		{
+			return m_Scene->AddComponent<T>(m_ID, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		void RemoveComponent()
+		{
+			m_Scene->RemoveComponent<T>(m_ID);
+		}
+
+		template<typename T>
+		T& GetComponent()
+		{
+			return m_Scene->GetComponent<T>(m_ID);
+		}
+
+		template<typename T>
+		bool HasComponent() const
+		{
+			return m_Scene->HasComponent<T>(m_ID);
+		}
+
+		EntityID GetID() const { return m_ID; }
+		Scene* GetScene() const { return m_Scene; }
+
+		operator bool() const { return m_Scene && m_Scene->IsValid(m_ID); }
+		bool operator==(const Entity& other) const { return m_ID == other.m_ID && m_Scene == other.m_Scene; }
+		bool operator!=(const Entity& other) const { return !(*this == other); }
+
+	private:
+		EntityID m_ID = NullEntity;
+		Scene* m_Scene = nullptr;
+	};
+}
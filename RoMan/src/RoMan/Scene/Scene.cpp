@@ -0,0 +1,73 @@
+#include "rmpch.h"
+#include "Scene.h"
+
+#include "RoMan/Scene/Entity.h"
+#include "RoMan/Scene/Components.h"
+
+namespace RoMan
+{
+	uint32_t Scene::NextComponentTypeID()
+	{
+		static uint32_t s_NextTypeID = 0;
+		return s_NextTypeID++;
+	}
+
+	uint32_t Scene::NextQueryTypeID()
+	{
+		static uint32_t s_NextQueryID = 0;
+		return s_NextQueryID++;
+	}
+
+	Entity Scene::CreateEntity(const std::string& name)
+	{
+		EntityID id;
+		if (!m_FreeIndices.empty())
+		{
+			uint32_t index = m_FreeIndices.back();
+			m_FreeIndices.pop_back();
+			id = m_Entities[index];
+		}
+		else
+		{
+			RM_CORE_ASSERT(m_Entities.size() < EntityIndexMask, "Too many entities!");
+			id = (EntityID)m_Entities.size();
+			m_Entities.push_back(id);
+		}
+
+		m_EntityCount++;
+
+		Entity entity(id, this);
+		entity.AddComponent<TagComponent>(name.empty() ? "Entity" : name);
+		return entity;
+	}
+
+	void Scene::DestroyEntity(Entity entity)
+	{
+		EntityID id = entity.GetID();
+		RM_CORE_ASSERT(IsValid(id), "Destroying an invalid entity!");
+
+		for (auto& pool : m_Pools)
+		{
+			if (pool && pool->Has(id))
+				pool->Remove(id);
+		}
+
+		if (m_TransformHierarchy.Contains(id))
+			m_TransformHierarchy.Detach(id);
+
+		// Bump the generation so stale copies of this ID stop resolving
+		uint32_t index = GetEntityIndex(id);
+		m_Entities[index] = index | ((GetEntityGeneration(id) + 1) << EntityIndexBits);
+		if (m_Entities[index] == NullEntity)
+			m_Entities[index] = index;
+		m_FreeIndices.push_back(index);
+		m_EntityCount--;
+	}
+
+	bool Scene::IsValid(EntityID entity) const
+	{
+		uint32_t index = GetEntityIndex(entity);
+		// Free slots already hold the ID of their next entity, which hasn't been handed out yet
+		return entity != NullEntity && index < m_Entities.size() && m_Entities[index] == entity;
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "RoMan/Scene/ComponentPool.h"
+#include "RoMan/Scene/SceneView.h"
+#include "RoMan/Scene/TransformHierarchy.h"
+
+#include <string>
+
+namespace RoMan
+{
+	class Entity;
+
+	class Scene
+	{
+	public:
+		Scene() = default;
+		~Scene() = default;
+
+		Entity CreateEntity(const std::string& name = std::string());
+		void DestroyEntity(Entity entity);
+
+		bool IsValid(EntityID entity) const;
+		uint32_t GetEntityCount() const { return m_EntityCount; }
+
+		template<typename T, typename... Args>
+		T& AddComponent(EntityID entity, Args&&... args)
+		{
+			RM_CORE_ASSERT(IsValid(entity), "Invalid entity!");
+			return GetPool<T>().Add(entity, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		void RemoveComponent(EntityID entity)
+		{
+			GetPool<T>().Remove(entity);
+		}
+
+		template<typename T>
+		T& GetComponent(EntityID entity)
+		{
+			return GetPool<T>().Get(entity);
+		}
+
+		template<typename T>
+		bool HasComponent(EntityID entity) const
+		{
+			uint32_t typeID = GetComponentTypeID<T>();
+			return typeID < m_Pools.size() && m_Pools[typeID] && m_Pools[typeID]->Has(entity);
+		}
+
+		// Views of the same component types share one cached query, it only rebuilds after components were added or removed
+		template<typename... Ts>
+		SceneView<Ts...> View()
+		{
+			return SceneView<Ts...>(GetQuery<Ts...>());
+		}
+
+		TransformHierarchy& GetTransformHierarchy() { return m_TransformHierarchy; }
+
+		template<typename T>
+		ComponentPool<T>& GetPool()
+		{
+			uint32_t typeID = GetComponentTypeID<T>();
+			if (typeID >= m_Pools.size())
+				m_Pools.resize(typeID + 1);
+			if (!m_Pools[typeID])
+				m_Pools[typeID] = std::make_unique<ComponentPool<T>>();
+			return *static_cast<ComponentPool<T>*>(m_Pools[typeID].get());
+		}
+
+	private:
+		template<typename... Ts>
+		SceneQuery<Ts...>& GetQuery()
+		{
+			uint32_t queryID = GetQueryTypeID<Ts...>();
+			if (queryID >= m_Queries.size())
+				m_Queries.resize(queryID + 1);
+			if (!m_Queries[queryID])
+				m_Queries[queryID] = std::make_unique<SceneQuery<Ts...>>(&GetPool<Ts>()...);
+			return *static_cast<SceneQuery<Ts...>*>(m_Queries[queryID].get());
+		}
+
+		static uint32_t NextComponentTypeID();
+		static uint32_t NextQueryTypeID();
+
+		template<typename T>
+		static uint32_t GetComponentTypeID()
+		{
+			static const uint32_t typeID = NextComponentTypeID();
+			return typeID;
+		}
+
+		template<typename... Ts>
+		static uint32_t GetQueryTypeID()
+		{
+			static const uint32_t queryID = NextQueryTypeID();
+			return queryID;
+		}
+
+	private:
+		std::vector<Scope<ComponentPoolBase>> m_Pools;
+		std::vector<Scope<SceneQueryBase>> m_Queries;
+		TransformHierarchy m_TransformHierarchy;
+
+		std::vector<EntityID> m_Entities;  // Current ID of every slot, the generation tells if it's alive
+		std::vector<uint32_t> m_FreeIndices;
+		uint32_t m_EntityCount = 0;
+	};
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "RoMan/Scene/ComponentPool.h"
+#include "RoMan/Core/ThreadPool.h"
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+namespace RoMan
+{
+	class SceneQueryBase
+	{
+	public:
+		virtual ~SceneQueryBase() = default;
+	};
+
+	// The entities that have every component in Ts, with each component's position in its pool.
+	// The Scene keeps one per set of types. It is rebuilt from the smallest pool only when one of
+	// its pools gained or lost a component since the last build.
+	template<typename... Ts>
+	class SceneQuery : public SceneQueryBase
+	{
+	public:
+		SceneQuery(ComponentPool<Ts>*... pools)
+			: m_Pools(pools...)
+		{
+		}
+
+		void Refresh()
+		{
+			std::array<uint32_t, sizeof...(Ts)> versions = std::apply([](auto*... pools) { return std::array<uint32_t, sizeof...(Ts)>{ pools->GetVersion()... }; }, m_Pools);
+			if (m_Built && versions == m_Versions)
+				return;
+
+			m_Versions = versions;
+			m_Built = true;
+			Rebuild(std::index_sequence_for<Ts...>());
+		}
+
+		uint32_t GetSize() const { return (uint32_t)m_Entities.size(); }
+
+		// func(EntityID, Ts&...) for the matches in [begin, end)
+		template<typename Func>
+		void EachInRange(Func& func, uint32_t begin, uint32_t end) const
+		{
+			EachInRange(func, begin, end, std::index_sequence_for<Ts...>());
+		}
+
+	private:
+		template<size_t... I>
+		void Rebuild(std::index_sequence<I...>)
+		{
+			const ComponentPoolBase* lead = nullptr;
+			const ComponentPoolBase* candidates[] = { std::get<I>(m_Pools)... };
+			for (const ComponentPoolBase* pool : candidates)
+			{
+				if (!lead || pool->GetSize() < lead->GetSize())
+					lead = pool;
+			}
+
+			m_Entities.clear();
+			m_Indices.clear();
+
+			const EntityID* entities = lead->GetEntities();
+			for (uint32_t i = 0; i < lead->GetSize(); i++)
+			{
+				EntityID entity = entities[i];
+				if ((std::get<I>(m_Pools)->Has(entity) && ...))
+				{
+					m_Entities.push_back(entity);
+					m_Indices.push_back({ std::get<I>(m_Pools)->GetIndex(entity)... });
+				}
+			}
+		}
+
+		template<typename Func, size_t... I>
+		void EachInRange(Func& func, uint32_t begin, uint32_t end, std::index_sequence<I...>) const
+		{
+			std::tuple<Ts*...> components(std::get<I>(m_Pools)->GetComponents()...);
+			for (uint32_t i = begin; i < end; i++)
+				func(m_Entities[i], std::get<I>(components)[m_Indices[i][I]]...);
+		}
+
+	private:
+		std::tuple<ComponentPool<Ts>*...> m_Pools;
+		std::array<uint32_t, sizeof...(Ts)> m_Versions = {};
+		bool m_Built = false;
+
+		std::vector<EntityID> m_Entities;
+		std::vector<std::array<uint32_t, sizeof...(Ts)>> m_Indices;
+	};
+
+	// Entities that have every component in Ts, iterated from the Scene's cached query.
+	// Don't add or remove components while iterating.
+	template<typename... Ts>
+	class SceneView
+	{
+	public:
+		SceneView(SceneQuery<Ts...>& query)
+			: m_Query(&query)
+		{
+		}
+
+		// func(EntityID, Ts&...)
+		template<typename Func>
+		void Each(Func func) const
+		{
+			m_Query->Refresh();
+			m_Query->EachInRange(func, 0, m_Query->GetSize());
+		}
+
+		// Same as Each, but chunks of the matches run on the ThreadPool. func must be safe to call
+		// concurrently for different entities.
+		template<typename Func>
+		void ParallelEach(Func func, uint32_t chunkSize = 4096) const
+		{
+			m_Query->Refresh();
+			SceneQuery<Ts...>* query = m_Query;
+			ThreadPool::ParallelFor(query->GetSize(), chunkSize, [query, &func](uint32_t begin, uint32_t end)
+			{
+				query->EachInRange(func, begin, end);
+			});
+		}
+
+		uint32_t GetSize() const
+		{
+			m_Query->Refresh();
+			return m_Query->GetSize();
+		}
+
+	private:
+		SceneQuery<Ts...>* m_Query;
+	};
+}
@@ -0,0 +1,159 @@
+#include "rmpch.h"
+#include "SpatialGrid.h"
+
+#include <cmath>
+
+namespace RoMan
+{
+	SpatialGrid::SpatialGrid(float cellSize, uint32_t cellTableSize)
+		: m_CellSize(cellSize), m_InverseCellSize(1.0f / cellSize)
+	{
+		RM_CORE_ASSERT(cellSize > 0.0f, "Cell size must be positive!");
+
+		uint32_t tableSize = 1;
+		while (tableSize < cellTableSize)
+			tableSize <<= 1;
+
+		m_Cells.resize(tableSize);
+		m_CellMask = tableSize - 1;
+	}
+
+	uint32_t SpatialGrid::Insert(const glm::vec2& min, const glm::vec2& max, uint32_t userData)
+	{
+		uint32_t item;
+		if (!m_FreeItems.empty())
+		{
+			item = m_FreeItems.back();
+			m_FreeItems.pop_back();
+		}
+		else
+		{
+			item = (uint32_t)m_Bounds.size();
+			m_Bounds.emplace_back();
+			m_CellCoords.emplace_back();
+			m_CellIndices.push_back(InvalidCell);
+			m_CellSlots.push_back(0);
+			m_UserData.push_back(0);
+		}
+
+		m_Bounds[item] = { min.x, min.y, max.x, max.y };
+		m_UserData[item] = userData;
+		m_MaxHalfSize = std::max(m_MaxHalfSize, std::max(max.x - min.x, max.y - min.y) * 0.5f);
+		Link(item, GetCellCoord((min + max) * 0.5f));
+
+		m_Size++;
+		return item;
+	}
+
+	void SpatialGrid::Update(uint32_t item, const glm::vec2& min, const glm::vec2& max)
+	{
+		RM_CORE_ASSERT(item < m_Bounds.size() && m_CellIndices[item] != InvalidCell, "Invalid spatial grid item!");
+
+		m_Bounds[item] = { min.x, min.y, max.x, max.y };
+		m_MaxHalfSize = std::max(m_MaxHalfSize, std::max(max.x - min.x, max.y - min.y) * 0.5f);
+
+		// Most moves stay inside the cell
+		glm::ivec2 coord = GetCellCoord((min + max) * 0.5f);
+		if (coord == m_CellCoords[item])
+			return;
+
+		Unlink(item);
+		Link(item, coord);
+	}
+
+	void SpatialGrid::Remove(uint32_t item)
+	{
+		RM_CORE_ASSERT(item < m_Bounds.size() && m_CellIndices[item] != InvalidCell, "Invalid spatial grid item!");
+
+		Unlink(item);
+		m_FreeItems.push_back(item);
+		m_Size--;
+	}
+
+	void SpatialGrid::Clear()
+	{
+		for (std::vector<uint32_t>& cell : m_Cells)
+			cell.clear();
+
+		m_Bounds.clear();
+		m_CellCoords.clear();
+		m_CellIndices.clear();
+		m_CellSlots.clear();
+		m_UserData.clear();
+		m_FreeItems.clear();
+		m_Size = 0;
+		m_MaxHalfSize = 0.0f;
+	}
+
+	uint32_t SpatialGrid::Query(const glm::vec2& min, const glm::vec2& max, std::vector<uint32_t>& out) const
+	{
+		size_t firstResult = out.size();
+
+		// Items are filed under their center, so anything overlapping the box has its center within
+		// the box grown by the largest half size
+		glm::ivec2 first = GetCellCoord(min - m_MaxHalfSize);
+		glm::ivec2 last = GetCellCoord(max + m_MaxHalfSize);
+
+		uint64_t cellCount = (uint64_t)(last.x - first.x + 1) * (uint64_t)(last.y - first.y + 1);
+		if (cellCount > m_Cells.size())
+		{
+			// Zoomed out past the table size, a linear pass is cheaper than revisiting hashed cells
+			for (uint32_t item = 0; item < (uint32_t)m_Bounds.size(); item++)
+			{
+				if (m_CellIndices[item] != InvalidCell && Overlaps(item, min, max))
+					out.push_back(m_UserData[item]);
+			}
+			return (uint32_t)(out.size() - firstResult);
+		}
+
+		for (int y = first.y; y <= last.y; y++)
+		{
+			for (int x = first.x; x <= last.x; x++)
+			{
+				glm::ivec2 coord(x, y);
+				for (uint32_t item : m_Cells[GetCellIndex(coord)])
+				{
+					// Other cells hashed to the same slot are visited under their own coordinate
+					if (m_CellCoords[item] == coord && Overlaps(item, min, max))
+						out.push_back(m_UserData[item]);
+				}
+			}
+		}
+
+		return (uint32_t)(out.size() - firstResult);
+	}
+
+	glm::ivec2 SpatialGrid::GetCellCoord(const glm::vec2& position) const
+	{
+		return { (int)std::floor(position.x * m_InverseCellSize), (int)std::floor(position.y * m_InverseCellSize) };
+	}
+
+	uint32_t SpatialGrid::GetCellIndex(const glm::ivec2& coord) const
+	{
+		return ((uint32_t)coord.x * 73856093u ^ (uint32_t)coord.y * 19349663u) & m_CellMask;
+	}
+
+	void SpatialGrid::Link(uint32_t item, const glm::ivec2& coord)
+	{
+		uint32_t cellIndex = GetCellIndex(coord);
+		std::vector<uint32_t>& cell = m_Cells[cellIndex];
+
+		m_CellCoords[item] = coord;
+		m_CellIndices[item] = cellIndex;
+		m_CellSlots[item] = (uint32_t)cell.size();
+		cell.push_back(item);
+	}
+
+	void SpatialGrid::Unlink(uint32_t item)
+	{
+		std::vector<uint32_t>& cell = m_Cells[m_CellIndices[item]];
+		uint32_t slot = m_CellSlots[item];
+
+		uint32_t moved = cell.back();
+		cell[slot] = moved;
+		m_CellSlots[moved] = slot;
+		cell.pop_back();
+
+		m_CellIndices[item] = InvalidCell;
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "RoMan/Core.h"
+#include "RoMan/Math/AABB.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace RoMan
+{
+	// Loose uniform grid over an unbounded 2D world. Every item lives in the single cell containing
+	// its center and cells are hashed into a fixed table, so moving an item only touches two cells
+	// and memory doesn't depend on how far apart items are. Queries widen their range by the largest
+	// half size ever inserted, keep cells a bit larger than typical items.
+	class SpatialGrid
+	{
+	public:
+		static constexpr uint32_t InvalidItem = 0xFFFFFFFF;
+
+		// cellTableSize is rounded up to a power of two
+		SpatialGrid(float cellSize = 1.0f, uint32_t cellTableSize = 1 << 16);
+
+		// Returns an item handle, userData is what queries report (e.g. an EntityID)
+		uint32_t Insert(const glm::vec2& min, const glm::vec2& max, uint32_t userData);
+		void Update(uint32_t item, const glm::vec2& min, const glm::vec2& max);
+		// Z is ignored
+		uint32_t Insert(const AABB& bounds, uint32_t userData) { return Insert({ bounds.Min.x, bounds.Min.y }, { bounds.Max.x, bounds.Max.y }, userData); }
+		void Update(uint32_t item, const AABB& bounds) { Update(item, { bounds.Min.x, bounds.Min.y }, { bounds.Max.x, bounds.Max.y }); }
+		void Remove(uint32_t item);
+		void Clear();
+
+		uint32_t GetUserData(uint32_t item) const { return m_UserData[item]; }
+		uint32_t GetSize() const { return m_Size; }
+		float GetCellSize() const { return m_CellSize; }
+
+		// Appends the user data of every item overlapping the box, returns how many were added
+		uint32_t Query(const glm::vec2& min, const glm::vec2& max, std::vector<uint32_t>& out) const;
+		uint32_t Query(const AABB& bounds, std::vector<uint32_t>& out) const { return Query({ bounds.Min.x, bounds.Min.y }, { bounds.Max.x, bounds.Max.y }, out); }
+		uint32_t QueryPoint(const glm::vec2& point, std::vector<uint32_t>& out) const { return Query(point, point, out); }
+
+	private:
+		static constexpr uint32_t InvalidCell = 0xFFFFFFFF;
+
+		glm::ivec2 GetCellCoord(const glm::vec2& position) const;
+		uint32_t GetCellIndex(const glm::ivec2& coord) const;
+
+		void Link(uint32_t item, const glm::ivec2& coord);
+		void Unlink(uint32_t item);
+
+		bool Overlaps(uint32_t item, const glm::vec2& min, const glm::vec2& max) const
+		{
+			const glm::vec4& bounds = m_Bounds[item];
+			return bounds.x <= max.x && bounds.z >= min.x && bounds.y <= max.y && bounds.w >= min.y;
+		}
+
+	private:
+		float m_CellSize;
+		float m_InverseCellSize;
+		uint32_t m_CellMask;
+		float m_MaxHalfSize = 0.0f;
+
+		std::vector<std::vector<uint32_t>> m_Cells;
+
+		// Per item, indexed by handle
+		std::vector<glm::vec4> m_Bounds;  // min x, min y, max x, max y
+		std::vector<glm::ivec2> m_CellCoords;
+		std::vector<uint32_t> m_CellIndices;  // InvalidCell for free handles
+		std::vector<uint32_t> m_CellSlots;
+		std::vector<uint32_t> m_UserData;
+
+		std::vector<uint32_t> m_FreeItems;
+		uint32_t m_Size = 0;
+	};
+}
@@ -0,0 +1,320 @@
+#include "rmpch.h"
+#include "TransformHierarchy.h"
+
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Core/ThreadPool.h"
+#include "RoMan/Math/BatchTransform.h"
+
+namespace RoMan
+{
+	// Levels smaller than this aren't worth handing to the ThreadPool
+	static constexpr uint32_t s_ParallelChunkSize = 1024;
+
+	uint32_t TransformHierarchy::GetNode(EntityID entity) const
+	{
+		uint32_t index = GetEntityIndex(entity);
+		RM_CORE_ASSERT(index < m_EntityToNode.size() && m_EntityToNode[index] != InvalidNode
+			&& m_Entities[m_EntityToNode[index]] == entity, "Entity is not in the transform hierarchy!");
+		return m_EntityToNode[index];
+	}
+
+	bool TransformHierarchy::Contains(EntityID entity) const
+	{
+		uint32_t index = GetEntityIndex(entity);
+		return index < m_EntityToNode.size() && m_EntityToNode[index] != InvalidNode && m_Entities[m_EntityToNode[index]] == entity;
+	}
+
+	void TransformHierarchy::Attach(EntityID entity, EntityID parent)
+	{
+		RM_CORE_ASSERT(!Contains(entity), "Entity is already in the transform hierarchy!");
+		RM_CORE_ASSERT(parent == NullEntity || Contains(parent), "Parent is not in the transform hierarchy!");
+
+		// The entity may have been detached with children still pointing at it
+		if (m_OrphansPending)
+			ReparentOrphans();
+
+		uint32_t index = GetEntityIndex(entity);
+		if (index >= m_EntityToNode.size())
+			m_EntityToNode.resize(index + 1, InvalidNode);
+		m_EntityToNode[index] = (uint32_t)m_Entities.size();
+
+		m_Entities.push_back(entity);
+		m_ParentEntities.push_back(parent);
+		m_Parents.push_back(InvalidNode);
+		m_TranslationX.push_back(0.0f);
+		m_TranslationY.push_back(0.0f);
+		m_TranslationZ.push_back(0.0f);
+		m_Rotations.push_back(0.0f);
+		m_ScaleX.push_back(1.0f);
+		m_ScaleY.push_back(1.0f);
+		m_ScaleZ.push_back(1.0f);
+		m_WorldTransforms.emplace_back(1.0f);
+		m_LocalDirty.push_back(1);
+		m_WorldChanged.push_back(0);
+
+		m_OrderDirty = true;
+	}
+
+	void TransformHierarchy::Detach(EntityID entity)
+	{
+		uint32_t node = GetNode(entity);
+
+		// Children keep pointing at the detached entity until ReparentOrphans, one pass for any
+		// number of detaches. GetParent already reports them as roots.
+		m_OrphansPending = true;
+
+		// Swap-remove, the breadth-first order is restored by the next Update
+		uint32_t last = (uint32_t)m_Entities.size() - 1;
+		if (node != last)
+		{
+			m_Entities[node] = m_Entities[last];
+			m_ParentEntities[node] = m_ParentEntities[last];
+			m_TranslationX[node] = m_TranslationX[last];
+			m_TranslationY[node] = m_TranslationY[last];
+			m_TranslationZ[node] = m_TranslationZ[last];
+			m_Rotations[node] = m_Rotations[last];
+			m_ScaleX[node] = m_ScaleX[last];
+			m_ScaleY[node] = m_ScaleY[last];
+			m_ScaleZ[node] = m_ScaleZ[last];
+			m_WorldTransforms[node] = m_WorldTransforms[last];
+			m_LocalDirty[node] = m_LocalDirty[last];
+			m_WorldChanged[node] = m_WorldChanged[last];
+			m_EntityToNode[GetEntityIndex(m_Entities[node])] = node;
+		}
+
+		m_Entities.pop_back();
+		m_ParentEntities.pop_back();
+		m_Parents.pop_back();
+		m_TranslationX.pop_back();
+		m_TranslationY.pop_back();
+		m_TranslationZ.pop_back();
+		m_Rotations.pop_back();
+		m_ScaleX.pop_back();
+		m_ScaleY.pop_back();
+		m_ScaleZ.pop_back();
+		m_WorldTransforms.pop_back();
+		m_LocalDirty.pop_back();
+		m_WorldChanged.pop_back();
+		m_EntityToNode[GetEntityIndex(entity)] = InvalidNode;
+
+		m_OrderDirty = true;
+	}
+
+	void TransformHierarchy::SetParent(EntityID entity, EntityID parent)
+	{
+		uint32_t node = GetNode(entity);
+		RM_CORE_ASSERT(parent == NullEntity || Contains(parent), "Parent is not in the transform hierarchy!");
+
+#ifdef RM_ENABLE_ASSERTS
+		for (EntityID ancestor = parent; ancestor != NullEntity; ancestor = GetParent(ancestor))
+			RM_CORE_ASSERT(ancestor != entity, "Parenting an entity to its own descendant!");
+#endif
+
+		m_ParentEntities[node] = parent;
+		m_LocalDirty[node] = 1;
+		m_OrderDirty = true;
+	}
+
+	EntityID TransformHierarchy::GetParent(EntityID entity) const
+	{
+		EntityID parent = m_ParentEntities[GetNode(entity)];
+		return parent != NullEntity && Contains(parent) ? parent : NullEntity;
+	}
+
+	void TransformHierarchy::ReparentOrphans()
+	{
+		for (uint32_t i = 0; i < (uint32_t)m_ParentEntities.size(); i++)
+		{
+			EntityID parent = m_ParentEntities[i];
+			if (parent != NullEntity && !Contains(parent))
+			{
+				m_ParentEntities[i] = NullEntity;
+				m_LocalDirty[i] = 1;
+			}
+		}
+
+		m_OrphansPending = false;
+	}
+
+	void TransformHierarchy::SetLocalTranslation(EntityID entity, const glm::vec3& translation)
+	{
+		uint32_t node = GetNode(entity);
+		m_TranslationX[node] = translation.x;
+		m_TranslationY[node] = translation.y;
+		m_TranslationZ[node] = translation.z;
+		m_LocalDirty[node] = 1;
+	}
+
+	void TransformHierarchy::SetLocalRotation(EntityID entity, float rotation)
+	{
+		uint32_t node = GetNode(entity);
+		m_Rotations[node] = rotation;
+		m_LocalDirty[node] = 1;
+	}
+
+	void TransformHierarchy::SetLocalScale(EntityID entity, const glm::vec3& scale)
+	{
+		uint32_t node = GetNode(entity);
+		m_ScaleX[node] = scale.x;
+		m_ScaleY[node] = scale.y;
+		m_ScaleZ[node] = scale.z;
+		m_LocalDirty[node] = 1;
+	}
+
+	glm::vec3 TransformHierarchy::GetLocalTranslation(EntityID entity) const
+	{
+		uint32_t node = GetNode(entity);
+		return { m_TranslationX[node], m_TranslationY[node], m_TranslationZ[node] };
+	}
+
+	glm::vec3 TransformHierarchy::GetLocalScale(EntityID entity) const
+	{
+		uint32_t node = GetNode(entity);
+		return { m_ScaleX[node], m_ScaleY[node], m_ScaleZ[node] };
+	}
+
+	void TransformHierarchy::SortBreadthFirst()
+	{
+		if (m_OrphansPending)
+			ReparentOrphans();
+
+		uint32_t count = (uint32_t)m_Entities.size();
+
+		// Depth of every node, walking up until we hit a node whose depth is known
+		FrameVector<uint32_t> depths(count, InvalidNode);
+		FrameVector<uint32_t> stack;
+		uint32_t maxDepth = 0;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t node = i;
+			while (depths[node] == InvalidNode)
+			{
+				EntityID parent = m_ParentEntities[node];
+				if (parent == NullEntity)
+				{
+					depths[node] = 0;
+					break;
+				}
+				stack.push_back(node);
+				node = GetNode(parent);
+			}
+
+			uint32_t depth = depths[node];
+			while (!stack.empty())
+			{
+				depths[stack.back()] = ++depth;
+				stack.pop_back();
+			}
+			maxDepth = std::max(maxDepth, depths[i]);
+		}
+
+		// Counting sort by depth, stable so siblings keep their relative order
+		m_LevelOffsets.assign(maxDepth + 2, 0);
+		for (uint32_t i = 0; i < count; i++)
+			m_LevelOffsets[depths[i] + 1]++;
+		for (uint32_t level = 1; level < m_LevelOffsets.size(); level++)
+			m_LevelOffsets[level] += m_LevelOffsets[level - 1];
+
+		FrameVector<uint32_t> order(count);
+		FrameVector<uint32_t> cursor(m_LevelOffsets.begin(), m_LevelOffsets.end() - 1);
+		for (uint32_t i = 0; i < count; i++)
+			order[cursor[depths[i]]++] = i;
+
+		auto permute = [&order, count](auto& items)
+		{
+			std::remove_reference_t<decltype(items)> sorted;
+			sorted.reserve(count);
+			for (uint32_t i = 0; i < count; i++)
+				sorted.push_back(items[order[i]]);
+			items.swap(sorted);
+		};
+		permute(m_Entities);
+		permute(m_ParentEntities);
+		permute(m_TranslationX);
+		permute(m_TranslationY);
+		permute(m_TranslationZ);
+		permute(m_Rotations);
+		permute(m_ScaleX);
+		permute(m_ScaleY);
+		permute(m_ScaleZ);
+		permute(m_WorldTransforms);
+		permute(m_LocalDirty);
+		permute(m_WorldChanged);
+
+		for (uint32_t i = 0; i < count; i++)
+			m_EntityToNode[GetEntityIndex(m_Entities[i])] = i;
+
+		m_Parents.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+			m_Parents[i] = m_ParentEntities[i] == NullEntity ? InvalidNode : GetNode(m_ParentEntities[i]);
+
+		m_OrderDirty = false;
+	}
+
+	void TransformHierarchy::UpdateRange(uint32_t begin, uint32_t end)
+	{
+		auto changed = [this](uint32_t node)
+		{
+			uint32_t parent = m_Parents[node];
+			return m_LocalDirty[node] || (parent != InvalidNode && m_WorldChanged[parent]);
+		};
+
+		// Runs of changed nodes get their local matrices from one batch call, straight into the world transforms
+		uint32_t i = begin;
+		while (i < end)
+		{
+			for (; i < end && !changed(i); i++)
+				m_WorldChanged[i] = 0;
+
+			uint32_t runBegin = i;
+			for (; i < end && changed(i); i++)
+				m_WorldChanged[i] = 1;
+
+			if (runBegin == i)
+				break;
+
+			TransformSoA locals;
+			locals.TranslationX = m_TranslationX.data() + runBegin;
+			locals.TranslationY = m_TranslationY.data() + runBegin;
+			locals.TranslationZ = m_TranslationZ.data() + runBegin;
+			locals.Rotation = m_Rotations.data() + runBegin;
+			locals.ScaleX = m_ScaleX.data() + runBegin;
+			locals.ScaleY = m_ScaleY.data() + runBegin;
+			locals.ScaleZ = m_ScaleZ.data() + runBegin;
+			locals.Count = i - runBegin;
+			BatchTransform::ComputeModelMatrices(locals, &m_WorldTransforms[runBegin]);
+
+			// Parents are on an earlier level, never inside this run
+			for (uint32_t node = runBegin; node < i; node++)
+			{
+				if (m_Parents[node] != InvalidNode)
+					m_WorldTransforms[node] = m_WorldTransforms[m_Parents[node]] * m_WorldTransforms[node];
+				m_LocalDirty[node] = 0;
+			}
+		}
+	}
+
+	void TransformHierarchy::Update()
+	{
+		if (m_OrderDirty)
+			SortBreadthFirst();
+
+		// Nodes of one level only read the previous levels, so each level can be split across threads
+		for (uint32_t level = 0; level + 1 < m_LevelOffsets.size(); level++)
+		{
+			uint32_t begin = m_LevelOffsets[level];
+			uint32_t end = m_LevelOffsets[level + 1];
+
+			if (end - begin < s_ParallelChunkSize * 2)
+			{
+				UpdateRange(begin, end);
+				continue;
+			}
+
+			ThreadPool::ParallelFor(end - begin, s_ParallelChunkSize, [this, begin](uint32_t chunkBegin, uint32_t chunkEnd)
+			{
+				UpdateRange(begin + chunkBegin, begin + chunkEnd);
+			});
+		}
+	}
+}
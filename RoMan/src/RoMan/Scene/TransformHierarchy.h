@@ -0,0 +1,73 @@
+#pragma once
+
+#include "RoMan/Scene/ComponentPool.h"
+
+#include <glm/glm.hpp>
+
+namespace RoMan
+{
+	// Parent/child transforms for scene entities. Local TRS and world matrices are stored per node in
+	// flat arrays kept in breadth-first order, so every parent comes before its children and Update()
+	// is a single forward pass. Only nodes whose local transform changed, or whose parent's world
+	// transform changed, are recomputed. Each level is split across the ThreadPool, and local matrices
+	// come from the BatchTransform kernels, which is why local TRS is stored one component per array.
+	class TransformHierarchy
+	{
+	public:
+		void Attach(EntityID entity, EntityID parent = NullEntity);
+		// Children of a detached node become roots
+		void Detach(EntityID entity);
+
+		void SetParent(EntityID entity, EntityID parent);
+		EntityID GetParent(EntityID entity) const;
+		bool Contains(EntityID entity) const;
+
+		void SetLocalTranslation(EntityID entity, const glm::vec3& translation);
+		void SetLocalRotation(EntityID entity, float rotation);
+		void SetLocalScale(EntityID entity, const glm::vec3& scale);
+
+		glm::vec3 GetLocalTranslation(EntityID entity) const;
+		float GetLocalRotation(EntityID entity) const { return m_Rotations[GetNode(entity)]; }
+		glm::vec3 GetLocalScale(EntityID entity) const;
+
+		// Valid after Update()
+		const glm::mat4& GetWorldTransform(EntityID entity) const { return m_WorldTransforms[GetNode(entity)]; }
+		// True if the world transform was recomputed by the last Update()
+		bool HasChanged(EntityID entity) const { return m_WorldChanged[GetNode(entity)] != 0; }
+
+		void Update();
+
+		uint32_t GetNodeCount() const { return (uint32_t)m_Entities.size(); }
+
+		// Nodes in update order, for consumers that want to walk every world transform linearly
+		const EntityID* GetEntities() const { return m_Entities.data(); }
+		const glm::mat4* GetWorldTransforms() const { return m_WorldTransforms.data(); }
+
+	private:
+		static constexpr uint32_t InvalidNode = 0xFFFFFFFF;
+
+		uint32_t GetNode(EntityID entity) const;
+		// Children of detached nodes become roots
+		void ReparentOrphans();
+		void SortBreadthFirst();
+		void UpdateRange(uint32_t begin, uint32_t end);
+
+	private:
+		std::vector<EntityID> m_Entities;
+		std::vector<EntityID> m_ParentEntities;
+		std::vector<uint32_t> m_Parents;  // Node index of the parent, rebuilt by SortBreadthFirst
+
+		std::vector<float> m_TranslationX, m_TranslationY, m_TranslationZ;
+		std::vector<float> m_Rotations;
+		std::vector<float> m_ScaleX, m_ScaleY, m_ScaleZ;
+		std::vector<glm::mat4> m_WorldTransforms;
+
+		std::vector<uint8_t> m_LocalDirty;
+		std::vector<uint8_t> m_WorldChanged;
+
+		std::vector<uint32_t> m_LevelOffsets;  // First node of every depth, plus the node count
+		std::vector<uint32_t> m_EntityToNode;  // Indexed by entity index
+		bool m_OrderDirty = false;
+		bool m_OrphansPending = false;
+	};
+}
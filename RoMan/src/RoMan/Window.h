@@ -39,9 +39,19 @@ namespace RoMan
 		virtual void SetEventCallback(const EventCallbackFn& callback) = 0;
 		virtual void SetVSync(bool enabled) = 0;
 		virtual bool IsVSync() const = 0;
+		// Lets late frames tear instead of waiting a whole extra refresh, needs swap_control_tear support
+		virtual void SetAdaptiveVSync(bool enabled) = 0;
+		virtual bool IsAdaptiveVSync() const = 0;
 
 		virtual void* GetNativeWindow() const = 0;
 
+		// Render into an offscreen surface without a visible window, must be set before the Application is created
+		inline static void SetOffscreen(bool offscreen) { s_Offscreen = offscreen; }
+		inline static bool IsOffscreen() { return s_Offscreen; }
+
 		static Window* Create(const WindowProps& props = WindowProps());
+
+	private:
+		inline static bool s_Offscreen = false;
 	};
 }
\ No newline at end of file
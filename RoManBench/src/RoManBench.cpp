@@ -0,0 +1,534 @@
+#include "rmpch.h"
+
+#include "RoMan/Core/BinaryLog.h"
+#include "RoMan/Core/CommandLine.h"
+#include "RoMan/Core/Compression.h"
+#include "RoMan/Core/FrameAllocator.h"
+#include "RoMan/Core/Ref.h"
+#include "RoMan/Core/ThreadPool.h"
+#include "RoMan/Core/Timer.h"
+#include "RoMan/Math/BatchTransform.h"
+#include "RoMan/Renderer/Buffer.h"
+#include "RoMan/Renderer/OrthographicCamera.h"
+#include "RoMan/Renderer/Renderer.h"
+#include "RoMan/Renderer/Shader.h"
+#include "RoMan/Renderer/VertexArray.h"
+#include "RoMan/Scene/Components.h"
+#include "RoMan/Scene/Entity.h"
+#include "RoMan/Scene/Scene.h"
+#include "RoMan/Scene/SpatialGrid.h"
+#include "RoMan/Scene/TransformHierarchy.h"
+
+#include "glm/gtc/matrix_transform.hpp"
+
+#include <random>
+
+// Reproduces the measurements quoted for the engine's containers and hot paths:
+//   RoManBench [--count N] [--repeat N] [--async-log] [benchmark...]
+// Every benchmark runs when none is named. Times are the best of the repeats.
+// The log benchmark writes to the console, redirect stdout to a file to time the sinks and not the terminal.
+
+struct BenchmarkOptions
+{
+	uint32_t Count = 0;  // 0 for the benchmark's default
+	uint32_t Repeat = 5;
+	bool AsyncLog = false;
+};
+
+using BenchmarkFunc = void(*)(const BenchmarkOptions& options);
+
+struct Benchmark
+{
+	const char* Name;
+	const char* Description;
+	uint32_t DefaultCount;
+	BenchmarkFunc Run;
+};
+
+template<typename Func>
+static float MeasureBest(uint32_t repeat, Func func)
+{
+	float best = 3.4e38f;
+	for (uint32_t i = 0; i < repeat; i++)
+	{
+		RoMan::Timer timer;
+		func();
+		best = std::min(best, timer.ElapsedMillis());
+	}
+	return best;
+}
+
+// Keeps results alive so the optimizer can't drop the measured work
+static volatile uint64_t s_Sink = 0;
+
+struct BenchResource : public RoMan::RefCounted
+{
+	uint32_t Value = 0;
+};
+
+static void RunRef(const BenchmarkOptions& options)
+{
+	uint32_t count = options.Count;
+
+	// Slots alternate between two objects, so every assignment releases one and retains the other
+	RoMan::Ref<BenchResource> refs[2] = { RoMan::CreateRef<BenchResource>(), RoMan::CreateRef<BenchResource>() };
+	std::shared_ptr<BenchResource> shareds[2] = { std::make_shared<BenchResource>(), std::make_shared<BenchResource>() };
+	std::vector<RoMan::Ref<BenchResource>> refSlots(64);
+	std::vector<std::shared_ptr<BenchResource>> sharedSlots(64);
+
+	float refTime = MeasureBest(options.Repeat, [&]()
+	{
+		for (uint32_t i = 0; i < count; i++)
+			refSlots[i & 63] = refs[(i >> 6) & 1];
+	});
+	float sharedTime = MeasureBest(options.Repeat, [&]()
+	{
+		for (uint32_t i = 0; i < count; i++)
+			sharedSlots[i & 63] = shareds[(i >> 6) & 1];
+	});
+
+	refs[0]->SetAtomicRefCount(true);
+	refs[1]->SetAtomicRefCount(true);
+	float atomicTime = MeasureBest(options.Repeat, [&]()
+	{
+		for (uint32_t i = 0; i < count; i++)
+			refSlots[i & 63] = refs[(i >> 6) & 1];
+	});
+
+	RM_CORE_INFO("ref: {0} copies, Ref {1:.2f} ns, atomic Ref {2:.2f} ns, shared_ptr {3:.2f} ns per copy", count,
+		refTime * 1e6f / count, atomicTime * 1e6f / count, sharedTime * 1e6f / count);
+}
+
+template<typename ShaderHandle, typename VertexArrayHandle>
+struct BenchDrawCommand
+{
+	ShaderHandle Shader;
+	VertexArrayHandle VertexArray;
+	glm::mat4 Transform;
+};
+
+static void RunSubmit(const BenchmarkOptions& options)
+{
+	uint32_t count = options.Count;
+
+	// Headless, so the time is the engine's side of a draw and not the driver's
+	RoMan::RendererAPI::SetAPI(RoMan::RendererAPI::API::Null);
+	RoMan::Renderer::Init();
+
+	RoMan::Ref<RoMan::Shader> shader = RoMan::Shader::Create("Bench", "", "");
+	RoMan::Ref<RoMan::VertexArray> vertexArray(RoMan::VertexArray::Create());
+	float vertices[3 * 3] = { -0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f, 0.0f, 0.5f, 0.0f };
+	RoMan::Ref<RoMan::VertexBuffer> vertexBuffer(RoMan::VertexBuffer::Create(vertices, sizeof(vertices)));
+	vertexBuffer->SetLayout({ { RoMan::ShaderDataType::Float3, "a_Position" } });
+	vertexArray->AddVertexBuffer(vertexBuffer);
+	uint32_t indices[3] = { 0, 1, 2 };
+	vertexArray->SetIndexBuffer(RoMan::Ref<RoMan::IndexBuffer>(RoMan::IndexBuffer::Create(indices, 3)));
+	vertexArray->SetBounds({ { -0.5f, -0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f } });
+
+	// The game submits straight from its members, a renderer queue copies the handles into its commands first.
+	// Before Ref, the handles were shared_ptrs, here they alias the same objects so only the handle type differs.
+	std::shared_ptr<RoMan::Shader> sharedShader(shader.get(), [](RoMan::Shader*) {});
+	std::shared_ptr<RoMan::VertexArray> sharedVertexArray(vertexArray.get(), [](RoMan::VertexArray*) {});
+
+	RoMan::OrthographicCamera camera(-16.0f, 16.0f, -9.0f, 9.0f);
+	std::vector<glm::mat4> transforms(count);
+	for (uint32_t i = 0; i < count; i++)
+		transforms[i] = glm::translate(glm::mat4(1.0f), glm::vec3((float)(i % 32) - 16.0f, (float)(i / 32 % 18) - 9.0f, 0.0f));
+
+	std::vector<BenchDrawCommand<RoMan::Ref<RoMan::Shader>, RoMan::Ref<RoMan::VertexArray>>> refQueue;
+	std::vector<BenchDrawCommand<std::shared_ptr<RoMan::Shader>, std::shared_ptr<RoMan::VertexArray>>> sharedQueue;
+	refQueue.reserve(count);
+	sharedQueue.reserve(count);
+
+	float directTime = MeasureBest(options.Repeat, [&]()
+	{
+		RoMan::Renderer::BeginScene(camera);
+		for (uint32_t i = 0; i < count; i++)
+			RoMan::Renderer::Submit(shader, vertexArray, transforms[i]);
+		RoMan::Renderer::EndScene();
+	});
+	float refQueueTime = MeasureBest(options.Repeat, [&]()
+	{
+		refQueue.clear();
+		for (uint32_t i = 0; i < count; i++)
+			refQueue.push_back({ shader, vertexArray, transforms[i] });
+
+		RoMan::Renderer::BeginScene(camera);
+		for (const auto& command : refQueue)
+			RoMan::Renderer::Submit(command.Shader, command.VertexArray, command.Transform);
+		RoMan::Renderer::EndScene();
+	});
+	float sharedQueueTime = MeasureBest(options.Repeat, [&]()
+	{
+		sharedQueue.clear();
+		for (uint32_t i = 0; i < count; i++)
+			sharedQueue.push_back({ sharedShader, sharedVertexArray, transforms[i] });
+
+		// Submit itself only takes its handles by reference, so the same Submit call keeps the comparison to the handle copies
+		RoMan::Renderer::BeginScene(camera);
+		for (const auto& command : sharedQueue)
+			RoMan::Renderer::Submit(shader, vertexArray, command.Transform);
+		RoMan::Renderer::EndScene();
+	});
+	refQueue.clear();
+	sharedQueue.clear();
+
+	RM_CORE_INFO("submit: {0} Renderer::Submit calls on the Null backend, direct {1:.1f} ns per draw", count, directTime * 1e6f / count);
+	RM_CORE_INFO("submit: through a draw queue, Ref handles {0:.1f} ns, shared_ptr handles (before) {1:.1f} ns per draw",
+		refQueueTime * 1e6f / count, sharedQueueTime * 1e6f / count);
+}
+
+static void RunECS(const BenchmarkOptions& options)
+{
+	uint32_t count = options.Count;
+
+	// Every entity has both components, plus the TagComponent each entity gets
+	RoMan::Scope<RoMan::Scene> scene;
+	float buildTime = MeasureBest(options.Repeat, [&]()
+	{
+		scene = std::make_unique<RoMan::Scene>();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			RoMan::EntityID entity = scene->CreateEntity().GetID();
+			scene->AddComponent<RoMan::TransformComponent>(entity, glm::vec3((float)i, 0.0f, 0.0f));
+			scene->AddComponent<RoMan::SpriteRendererComponent>(entity);
+		}
+	});
+
+	// The first use builds the cached query, later ones reuse it until components are added or removed
+	auto view = scene->View<RoMan::TransformComponent, RoMan::SpriteRendererComponent>();
+	RoMan::Timer queryTimer;
+	uint32_t matches = view.GetSize();
+	float queryTime = queryTimer.ElapsedMillis();
+
+	float eachTime = MeasureBest(options.Repeat, [&]()
+	{
+		float sum = 0.0f;
+		view.Each([&sum](RoMan::EntityID, RoMan::TransformComponent& transform, RoMan::SpriteRendererComponent& sprite)
+		{
+			transform.Rotation += 0.01f;
+			sum += transform.Translation.x * sprite.Color.a;
+		});
+		s_Sink += (uint64_t)sum;
+	});
+	float parallelTime = MeasureBest(options.Repeat, [&]()
+	{
+		view.ParallelEach([](RoMan::EntityID, RoMan::TransformComponent& transform, RoMan::SpriteRendererComponent&)
+		{
+			transform.Rotation += 0.01f;
+		});
+	});
+
+	RM_CORE_INFO("ecs: {0} entities with Transform and Sprite: build {1:.1f} ms, query build {2:.2f} ms for {3} matches", count, buildTime, queryTime, matches);
+	RM_CORE_INFO("ecs: cached View<Transform, Sprite> Each {0:.2f} ms, ParallelEach {1:.2f} ms on {2} workers",
+		eachTime, parallelTime, RoMan::ThreadPool::GetWorkerCount());
+}
+
+static void RunTransform(const BenchmarkOptions& options)
+{
+	uint32_t count = options.Count;
+
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> position(-100.0f, 100.0f), angle(-6.28f, 6.28f), scale(0.1f, 4.0f);
+	std::vector<float> translationX(count), translationY(count), translationZ(count), rotation(count), scaleX(count), scaleY(count), scaleZ(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		translationX[i] = position(random);
+		translationY[i] = position(random);
+		translationZ[i] = position(random);
+		rotation[i] = angle(random);
+		scaleX[i] = scale(random);
+		scaleY[i] = scale(random);
+		scaleZ[i] = scale(random);
+	}
+
+	RoMan::TransformSoA transforms;
+	transforms.TranslationX = translationX.data();
+	transforms.TranslationY = translationY.data();
+	transforms.TranslationZ = translationZ.data();
+	transforms.Rotation = rotation.data();
+	transforms.ScaleX = scaleX.data();
+	transforms.ScaleY = scaleY.data();
+	transforms.ScaleZ = scaleZ.data();
+	transforms.Count = count;
+
+	std::vector<glm::mat4> reference(count), matrices(count);
+	RoMan::BatchTransform::SetSimdLevel(RoMan::SimdLevel::Scalar);
+	RoMan::BatchTransform::ComputeModelMatrices(transforms, reference.data());
+
+	RoMan::SimdLevel supported = RoMan::BatchTransform::GetSupportedSimdLevel();
+	for (int level = 0; level <= (int)supported; level++)
+	{
+		RoMan::BatchTransform::SetSimdLevel((RoMan::SimdLevel)level);
+		float time = MeasureBest(options.Repeat, [&]() { RoMan::BatchTransform::ComputeModelMatrices(transforms, matrices.data()); });
+
+		float maxError = 0.0f;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			for (int column = 0; column < 4; column++)
+			{
+				for (int row = 0; row < 4; row++)
+				{
+					float expected = reference[i][column][row];
+					float error = std::abs(matrices[i][column][row] - expected) / std::max(std::abs(expected), 1.0f);
+					maxError = std::max(maxError, error);
+				}
+			}
+		}
+
+		RM_CORE_INFO("transform: {0} model matrices, {1} {2:.3f} ms, max relative error {3:.2e}", count,
+			RoMan::BatchTransform::GetSimdLevelName((RoMan::SimdLevel)level), time, maxError);
+	}
+	RoMan::BatchTransform::SetSimdLevel(supported);
+
+	// A flat hierarchy under one root, moving the root dirties every node
+	RoMan::TransformHierarchy hierarchy;
+	RoMan::EntityID root = 0;
+	hierarchy.Attach(root);
+	for (uint32_t i = 1; i < count; i++)
+	{
+		hierarchy.Attach(i, root);
+		hierarchy.SetLocalTranslation(i, { translationX[i], translationY[i], translationZ[i] });
+		hierarchy.SetLocalRotation(i, rotation[i]);
+	}
+	hierarchy.Update();
+
+	float x = 0.0f;
+	float hierarchyTime = MeasureBest(options.Repeat, [&]()
+	{
+		hierarchy.SetLocalTranslation(root, { x += 1.0f, 0.0f, 0.0f });
+		hierarchy.Update();
+	});
+	RM_CORE_INFO("transform: TransformHierarchy update of {0} nodes under a moved root {1:.3f} ms", count, hierarchyTime);
+}
+
+static void MeasureGrid(uint32_t count, uint32_t repeat)
+{
+	// 0.1 unit items in 1 unit cells at 4 items per unit^2, queried through a 32x18 window
+	float side = std::sqrt(count / 4.0f);
+	std::mt19937 random(1);
+	std::uniform_real_distribution<float> coordinate(0.0f, side), jitter(-0.02f, 0.02f);
+
+	std::vector<glm::vec2> positions(count);
+	for (glm::vec2& position : positions)
+		position = { coordinate(random), coordinate(random) };
+
+	const glm::vec2 halfSize(0.05f);
+	RoMan::SpatialGrid grid(1.0f, 1 << 18);
+	std::vector<uint32_t> items(count);
+	float insertTime = MeasureBest(repeat, [&]()
+	{
+		grid.Clear();
+		for (uint32_t i = 0; i < count; i++)
+			items[i] = grid.Insert(positions[i] - halfSize, positions[i] + halfSize, i);
+	});
+
+	for (glm::vec2& position : positions)
+		position += glm::vec2(jitter(random), jitter(random));
+	float updateTime = MeasureBest(repeat, [&]()
+	{
+		for (uint32_t i = 0; i < count; i++)
+			grid.Update(items[i], positions[i] - halfSize, positions[i] + halfSize);
+	});
+
+	for (glm::vec2& position : positions)
+		position = { coordinate(random), coordinate(random) };
+	float relocateTime = MeasureBest(1, [&]()
+	{
+		for (uint32_t i = 0; i < count; i++)
+			grid.Update(items[i], positions[i] - halfSize, positions[i] + halfSize);
+	});
+
+	glm::vec2 queryMin(side * 0.5f - 16.0f, side * 0.5f - 9.0f), queryMax(side * 0.5f + 16.0f, side * 0.5f + 9.0f);
+	std::vector<uint32_t> found;
+	float queryTime = MeasureBest(repeat, [&]()
+	{
+		found.clear();
+		grid.Query(queryMin, queryMax, found);
+	});
+	float scanTime = MeasureBest(repeat, [&]()
+	{
+		uint32_t hits = 0;
+		for (const glm::vec2& position : positions)
+		{
+			glm::vec2 min = position - halfSize, max = position + halfSize;
+			hits += min.x <= queryMax.x && max.x >= queryMin.x && min.y <= queryMax.y && max.y >= queryMin.y;
+		}
+		s_Sink += hits;
+	});
+
+	RM_CORE_INFO("grid: {0} items, insert {1:.1f} M/s, small-move update {2:.1f} M/s, full relocation {3:.1f} ms", count,
+		count / (insertTime * 1000.0f), count / (updateTime * 1000.0f), relocateTime);
+	RM_CORE_INFO("grid: 32x18 query {0:.3f} ms for {1} items vs {2:.3f} ms linear scan", queryTime, found.size(), scanTime);
+}
+
+// The request's range, e.g. 100k and 1M items with the default count
+static void RunGrid(const BenchmarkOptions& options)
+{
+	MeasureGrid(options.Count, options.Repeat);
+	if (options.Count <= UINT32_MAX / 10)
+		MeasureGrid(options.Count * 10, options.Repeat);
+}
+
+static void RunCompression(const BenchmarkOptions& options)
+{
+	// Shader like text, repetitive with some variation, like the assets that get packed
+	std::string text;
+	for (uint32_t i = 0; text.size() < options.Count; i++)
+	{
+		text += "uniform vec4 u_Color" + std::to_string(i % 97) + ";\n";
+		text += "void main()\n{\n\tcolor = texture(u_Texture, v_TexCoord * " + std::to_string(i % 13) + ".0) * u_Color;\n}\n";
+	}
+	text.resize(options.Count);
+
+	std::vector<uint8_t> compressed;
+	float compressTime = MeasureBest(options.Repeat, [&]() { RoMan::Compression::Compress(RoMan::CompressionType::LZ4, text.data(), text.size(), compressed); });
+
+	std::vector<uint8_t> decompressed(text.size());
+	bool valid = true;
+	float decompressTime = MeasureBest(options.Repeat, [&]()
+	{
+		valid &= RoMan::Compression::Decompress(RoMan::CompressionType::LZ4, compressed.data(), compressed.size(), decompressed.data(), decompressed.size());
+	});
+	valid &= memcmp(decompressed.data(), text.data(), text.size()) == 0;
+
+	float megabytes = text.size() / (1024.0f * 1024.0f);
+	RM_CORE_INFO("compression: {0:.1f} MB of shader text -> {1:.1f}%, compress {2:.2f} GB/s, decompress {3:.2f} GB/s{4}", megabytes,
+		compressed.size() * 100.0f / text.size(), megabytes / compressTime, megabytes / decompressTime, valid ? "" : " (ROUND TRIP FAILED)");
+}
+
+static void RunLog(const BenchmarkOptions& options)
+{
+	uint32_t count = options.Count;
+
+	std::vector<float> latencies(count);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint64_t start = RoMan::Timer::Now();
+		RM_ERROR("Benchmark message {0} with a float {1:.3f}", i, i * 0.5f);
+		latencies[i] = (RoMan::Timer::Now() - start) / 1000.0f;
+	}
+	RoMan::Log::Flush();
+
+	std::sort(latencies.begin(), latencies.end());
+	double sum = 0.0;
+	for (float latency : latencies)
+		sum += latency;
+
+	RM_CORE_INFO("log: {0} RM_ERROR calls, {1}: mean {2:.2f} us, p50 {3:.2f} us, p99 {4:.2f} us", count, options.AsyncLog ? "async" : "sync",
+		sum / count, latencies[count / 2], latencies[(size_t)(count * 0.99)]);
+}
+
+static void RunBinaryLog(const BenchmarkOptions& options)
+{
+	uint32_t count = options.Count;
+
+	if (!RoMan::BinaryLog::Init("logs/RoManBench.rmlog"))
+		return;
+
+	float time = MeasureBest(options.Repeat, [&]()
+	{
+		for (uint32_t i = 0; i < count; i++)
+			RM_BINLOG("Benchmark record {0} with a float {1:.3f}", i, i * 0.5f);
+	});
+	uint64_t dropped = RoMan::BinaryLog::GetDroppedRecords();
+	RoMan::BinaryLog::Shutdown();
+
+	RM_CORE_INFO("binlog: {0} RM_BINLOG calls, {1:.1f} ns per call, {2} dropped", count, time * 1e6f / count, dropped);
+}
+
+static const Benchmark s_Benchmarks[] =
+{
+	{ "ref",         "Ref<T> copies against std::shared_ptr",                        10000000, RunRef },
+	{ "submit",      "Renderer::Submit on the Null backend, Ref against shared_ptr", 1000000,  RunSubmit },
+	{ "ecs",         "scene build and a cached two component view",                  1000000,  RunECS },
+	{ "transform",   "BatchTransform per SIMD level and a TransformHierarchy update", 100000,   RunTransform },
+	{ "grid",        "SpatialGrid insert, update and query at N and 10N items",      100000,   RunGrid },
+	{ "compression", "LZ4 on shader text, count is in bytes",                        8 << 20,  RunCompression },
+	{ "log",         "RM_ERROR call latency",                                        20000,    RunLog },
+	{ "binlog",      "RM_BINLOG call cost",                                          1000000,  RunBinaryLog },
+};
+
+static void PrintUsage()
+{
+	RM_CORE_INFO("Usage: RoManBench [--count N] [--repeat N] [--async-log] [benchmark...]");
+	RM_CORE_INFO("  --count N    items per benchmark instead of its default");
+	RM_CORE_INFO("  --repeat N   runs per measurement, the best one is reported (default 5)");
+	RM_CORE_INFO("  --async-log  log asynchronously, for the log benchmark");
+	for (const Benchmark& benchmark : s_Benchmarks)
+		RM_CORE_INFO("  {0:<12} {1} (default count {2})", benchmark.Name, benchmark.Description, benchmark.DefaultCount);
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkOptions options;
+	for (int i = 1; i < argc; i++)
+		options.AsyncLog |= strcmp(argv[i], "--async-log") == 0;
+
+	// The log benchmark measures the engine's own setup, so the file sink stays on
+	RoMan::LogSpecification logSpecification;
+	logSpecification.Async = options.AsyncLog;
+	logSpecification.FilePath = "logs/RoManBench.log";
+	logSpecification.Level = spdlog::level::trace;
+	RoMan::Log::Init(logSpecification);
+
+	std::vector<std::string> names;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--count" && i + 1 < argc)
+		{
+			if (!RoMan::CommandLine::ParseUInt32(argv[++i], options.Count) || options.Count == 0)
+			{
+				RM_CORE_ERROR("--count expects a positive number, got '{0}'", argv[i]);
+				PrintUsage();
+				return 1;
+			}
+		}
+		else if (arg == "--repeat" && i + 1 < argc)
+		{
+			if (!RoMan::CommandLine::ParseUInt32(argv[++i], options.Repeat) || options.Repeat == 0)
+			{
+				RM_CORE_ERROR("--repeat expects a positive number, got '{0}'", argv[i]);
+				PrintUsage();
+				return 1;
+			}
+		}
+		else if (arg != "--async-log")
+			names.push_back(arg);
+	}
+
+	for (const std::string& name : names)
+	{
+		auto it = std::find_if(std::begin(s_Benchmarks), std::end(s_Benchmarks), [&](const Benchmark& benchmark) { return name == benchmark.Name; });
+		if (it == std::end(s_Benchmarks))
+		{
+			RM_CORE_ERROR("Unknown benchmark {0}", name);
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	RoMan::FrameAllocator::Init(64 * 1024 * 1024);
+	RoMan::ThreadPool::Init();
+
+	for (const Benchmark& benchmark : s_Benchmarks)
+	{
+		if (!names.empty() && std::find(names.begin(), names.end(), benchmark.Name) == names.end())
+			continue;
+
+		BenchmarkOptions benchmarkOptions = options;
+		if (benchmarkOptions.Count == 0)
+			benchmarkOptions.Count = benchmark.DefaultCount;
+		benchmark.Run(benchmarkOptions);
+
+		RoMan::FrameAllocator::NextFrame();
+		RoMan::FrameAllocator::NextFrame();
+	}
+
+	RoMan::ThreadPool::Shutdown();
+	RoMan::FrameAllocator::Shutdown();
+	RoMan::Log::Shutdown();
+	return 0;
+}
@@ -0,0 +1,77 @@
+#include "rmpch.h"
+
+#include "RoMan/Asset/AssetCooker.h"
+#include "RoMan/Core/CommandLine.h"
+#include "RoMan/Core/ThreadPool.h"
+#include "RoMan/Core/Timer.h"
+
+// Cooks asset directories into runtime ready files:
+//   RoManCook [--force] [--jobs N] <output directory> <directory>...
+// Shaders are split into their stages, textures decoded to RGBA8 with a full mip chain, images
+// named *.virtual.png cut into pages for VirtualTexture2D, anything else is copied. Outputs keep the source paths, so the result packs with RoManPack as is:
+//   RoManCook Cooked assets && RoManPack Colosseum.rmpak Cooked/assets
+
+static void PrintUsage()
+{
+	RM_CORE_INFO("Usage: RoManCook [--force] [--jobs N] <output directory> <directory>...");
+	RM_CORE_INFO("  --force   cook everything, even inputs that didn't change since the last run");
+	RM_CORE_INFO("  --jobs N  number of threads, default one per hardware thread");
+}
+
+int main(int argc, char** argv)
+{
+	// Console only and synchronous, a tool's output is the point
+	RoMan::LogSpecification logSpecification;
+	logSpecification.Async = false;
+	logSpecification.FilePath.clear();
+	logSpecification.Level = spdlog::level::trace;
+	RoMan::Log::Init(logSpecification);
+
+	bool force = false;
+	uint32_t jobs = 0;
+	std::vector<std::string> positional;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--force")
+			force = true;
+		else if (arg == "--jobs" && i + 1 < argc)
+		{
+			if (!RoMan::CommandLine::ParseUInt32(argv[++i], jobs))
+			{
+				RM_CORE_ERROR("--jobs expects a thread count, got '{0}'", argv[i]);
+				PrintUsage();
+				return 1;
+			}
+		}
+		else
+			positional.push_back(arg);
+	}
+
+	if (positional.size() < 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// The main thread cooks too, a single job doesn't need the pool at all
+	if (jobs != 1)
+		RoMan::ThreadPool::Init(jobs > 0 ? jobs - 1 : 0);
+
+	RoMan::Timer timer;
+	RoMan::AssetCooker cooker(positional[0]);
+	bool success = true;
+	for (size_t i = 1; i < positional.size() && success; i++)
+		success = cooker.AddDirectory(positional[i]);
+
+	if (success)
+		success = cooker.Cook(force);
+
+	const RoMan::CookStats& stats = cooker.GetStats();
+	RM_CORE_INFO("Cooked {0}, {1} up to date, {2} failed, {3} removed in {4:.1f} ms: {5} bytes -> {6} bytes",
+		stats.Cooked, stats.UpToDate, stats.Failed, stats.Removed, timer.ElapsedMillis(), stats.InputBytes, stats.OutputBytes);
+
+	RoMan::ThreadPool::Shutdown();
+	return success ? 0 : 1;
+}
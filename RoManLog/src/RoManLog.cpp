@@ -0,0 +1,59 @@
+#include "rmpch.h"
+
+#include "RoMan/Core/BinaryLogReader.h"
+
+#include <cstdio>
+
+// Renders a binary log written by RM_BINLOG to text, one record per line ordered by time:
+//   RoManLog [--source] <file.rmlog>
+// Lines read "[seconds since start] [thread] message", redirect stdout to keep them.
+
+static void PrintUsage()
+{
+	RM_CORE_INFO("Usage: RoManLog [--source] <file.rmlog>");
+	RM_CORE_INFO("  --source  append the file and line of the RM_BINLOG call to every line");
+}
+
+int main(int argc, char** argv)
+{
+	// Console only and synchronous, a tool's output is the point
+	RoMan::LogSpecification logSpecification;
+	logSpecification.Async = false;
+	logSpecification.FilePath.clear();
+	logSpecification.Level = spdlog::level::trace;
+	RoMan::Log::Init(logSpecification);
+
+	bool source = false;
+	std::vector<std::string> positional;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--source")
+			source = true;
+		else
+			positional.push_back(arg);
+	}
+
+	if (positional.size() != 1)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	RoMan::BinaryLogReader reader;
+	if (!reader.Open(positional[0]))
+		return 1;
+
+	std::string line;
+	for (const RoMan::BinaryLogMessage& message : reader.GetMessages())
+	{
+		line = fmt::format("[{:12.6f}] [{}] {}", message.Time / 1e9, message.ThreadId, message.Text);
+		if (source)
+			line += fmt::format("  ({}:{})", reader.GetFile(message.FormatId), reader.GetLine(message.FormatId));
+		line += '\n';
+		fwrite(line.data(), 1, line.size(), stdout);
+	}
+
+	return 0;
+}
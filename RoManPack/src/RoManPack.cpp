@@ -0,0 +1,87 @@
+#include "rmpch.h"
+
+#include "RoMan/Asset/PackWriter.h"
+#include "RoMan/Core/CommandLine.h"
+
+#include <filesystem>
+
+// Packs asset directories into a .rmpak archive:
+//   RoManPack [--store] [--align N] <output.rmpak> <directory>...
+// Paths inside the pack are relative to each directory's parent, so packing "assets" from the
+// Colosseum folder keeps the "assets/shaders/Texture.glsl" paths the game loads.
+
+static void PrintUsage()
+{
+	RM_CORE_INFO("Usage: RoManPack [--store] [--align N] <output.rmpak> <directory>...");
+	RM_CORE_INFO("  --store    don't compress, every file is stored as is");
+	RM_CORE_INFO("  --align N  align every file to N bytes (power of two, default 16)");
+}
+
+int main(int argc, char** argv)
+{
+	// Console only and synchronous, a tool's output is the point
+	RoMan::LogSpecification logSpecification;
+	logSpecification.Async = false;
+	logSpecification.FilePath.clear();
+	logSpecification.Level = spdlog::level::trace;
+	RoMan::Log::Init(logSpecification);
+
+	RoMan::CompressionType compression = RoMan::CompressionType::LZ4;
+	uint32_t alignment = 16;
+	std::vector<std::string> positional;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		if (arg == "--store")
+			compression = RoMan::CompressionType::None;
+		else if (arg == "--align" && i + 1 < argc)
+		{
+			if (!RoMan::CommandLine::ParseUInt32(argv[++i], alignment))
+			{
+				RM_CORE_ERROR("--align expects a number of bytes, got '{0}'", argv[i]);
+				PrintUsage();
+				return 1;
+			}
+		}
+		else
+			positional.push_back(arg);
+	}
+
+	if (positional.size() < 2 || alignment == 0 || alignment > 4096 || (alignment & (alignment - 1)) != 0)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	namespace fs = std::filesystem;
+
+	RoMan::PackWriter writer;
+	for (size_t i = 1; i < positional.size(); i++)
+	{
+		fs::path directory = fs::path(positional[i]).lexically_normal();
+		if (!fs::is_directory(directory))
+		{
+			RM_CORE_ERROR("{0} is not a directory", directory.string());
+			return 1;
+		}
+
+		fs::path base = directory.has_parent_path() ? directory.parent_path() : fs::path();
+		for (const fs::directory_entry& entry : fs::recursive_directory_iterator(directory))
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			std::string packPath = fs::relative(entry.path(), base.empty() ? fs::current_path() : base).generic_string();
+			if (!writer.AddFileFromDisk(packPath, entry.path().string(), compression))
+				return 1;
+		}
+	}
+
+	if (!writer.Write(positional[0], alignment))
+		return 1;
+
+	RM_CORE_INFO("Packed {0} files into {1}: {2} bytes -> {3} bytes", writer.GetFileCount(), positional[0],
+		writer.GetTotalSize(), writer.GetTotalStoredSize());
+	return 0;
+}
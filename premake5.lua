@@ -74,8 +74,7 @@ project "RoMan"
 	{ 
 		"GLFW",
 		"Glad",
-		"ImGui",
-		"opengl32.lib"
+		"ImGui"
 	}
 
 	filter "system:windows"
@@ -88,6 +87,31 @@ project "RoMan"
 			"GLFW_INCLUDE_NONE"
 		}
 
+		links
+		{
+			"opengl32.lib",
+			"winmm.lib"
+		}
+
+		removefiles
+		{
+			"%{prj.name}/src/Platform/Linux/**"
+		}
+
+	filter "system:linux"
+		pic "On"
+
+		defines
+		{
+			"RM_PLATFORM_LINUX",
+			"GLFW_INCLUDE_NONE"
+		}
+
+		removefiles
+		{
+			"%{prj.name}/src/Platform/Windows/**"
+		}
+
 	filter "configurations:Debug"
 		defines "RM_DEBUG"
 		runtime "Debug"
@@ -141,6 +165,24 @@ project "Colosseum"
 			"RM_PLATFORM_WINDOWS"
 		}
 
+	filter "system:linux"
+		defines
+		{
+			"RM_PLATFORM_LINUX"
+		}
+
+		-- Static libraries don't carry their dependencies on Linux, so they are linked here
+		links
+		{
+			"GLFW",
+			"Glad",
+			"ImGui",
+			"GL",
+			"EGL",
+			"X11",
+			"pthread",
+			"dl"
+		}
 
 	filter "configurations:Debug"
 		defines "RM_DEBUG"
@@ -155,4 +197,90 @@ project "Colosseum"
 	filter "configurations:Dist"
 		defines "RM_DIST"
 		runtime "Release"
-		optimize "on"
\ No newline at end of file
+		optimize "on"
+
+-- Command line tools share one setup. Core only needs the standard library, the Linux links
+-- a tool takes on top of it are listed in extraLinks (e.g. Glad for code reaching the GL backend).
+function toolproject(name, extraLinks)
+	project(name)
+		location(name)
+		kind "ConsoleApp"
+		language "C++"
+		cppdialect "C++17"
+		staticruntime "on"
+
+		targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+		objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+		files
+		{
+			"%{prj.name}/src/**.h",
+			"%{prj.name}/src/**.cpp"
+		}
+
+		-- Tools report progress and results at info level, Dist included
+		defines
+		{
+			"SPDLOG_ACTIVE_LEVEL=SPDLOG_LEVEL_TRACE"
+		}
+
+		includedirs
+		{
+			"RoMan/vendor/spdlog/include",
+			"RoMan/src",
+			"RoMan/vendor",
+			"%{IncludeDir.glm}"
+		}
+
+		links
+		{
+			"RoMan"
+		}
+
+		filter "system:windows"
+			systemversion "latest"
+
+			defines
+			{
+				"RM_PLATFORM_WINDOWS"
+			}
+
+		filter "system:linux"
+			defines
+			{
+				"RM_PLATFORM_LINUX"
+			}
+
+			links(extraLinks or {})
+			links
+			{
+				"pthread",
+				"dl"
+			}
+
+		filter "configurations:Debug"
+			defines "RM_DEBUG"
+			runtime "Debug"
+			symbols "on"
+
+		filter "configurations:Release"
+			defines "RM_RELEASE"
+			runtime "Release"
+			optimize "on"
+
+		filter "configurations:Dist"
+			defines "RM_DIST"
+			runtime "Release"
+			optimize "on"
+
+		filter {}
+end
+
+group "Tools"
+	toolproject "RoManPack"
+	toolproject "RoManCook"
+	toolproject "RoManLog"
+	-- The renderer's factories reference the OpenGL backend even when the benchmark runs on the Null API
+	toolproject("RoManBench", { "Glad" })
+
+group ""